@@ -57,6 +57,7 @@ HEADERS += \
     include/Qube2D/System/Structs/Point.hpp \
     include/Qube2D/System/Structs/Rect.hpp \
     include/Qube2D/System/Structs/Size.hpp \
+    include/Qube2D/System/Structs/Transform.hpp \
     include/Qube2D/System/Uncopyable.hpp \
     include/Qube2D/Config.hpp \
     include/Qube2D/System/Storage/File.hpp \
@@ -90,6 +91,8 @@ HEADERS += \
     include/Qube2D/Debug/GLCheck.hpp \
     include/Qube2D/Graphics/System/OpenGL/VertexArray.hpp \
     include/Qube2D/Graphics/System/OpenGL/VertexBuffer.hpp \
+    include/Qube2D/Graphics/System/OpenGL/StreamBuffer.hpp \
+    include/Qube2D/Graphics/System/OpenGL/GLState.hpp \
     include/Qube2D/Graphics/System/OpenGL/GLEnums.hpp \
     include/Qube2D/Graphics/System/OpenGL/Texture.hpp \
     include/Qube2D/Graphics/System/OpenGL/Shader.hpp \
@@ -97,6 +100,8 @@ HEADERS += \
     include/Qube2D/Graphics/System/OpenGL/GLErrors.hpp \
     deps/lodepng/lodepng.h \
     include/Qube2D/Graphics/System/GraphicsEnums.hpp \
+    include/Qube2D/Graphics/System/QuadKernel.hpp \
+    include/Qube2D/Graphics/System/Culling.hpp \
     include/Qube2D/Graphics/System/Shader/PrimitiveShaders.hpp \
     include/Qube2D/Graphics/System/Shader/TextureShaders.hpp \
     include/Qube2D/Graphics/System/Base/ISprite.hpp \
@@ -105,10 +110,19 @@ HEADERS += \
     include/Qube2D/Graphics/System/Base/BaseEnums.hpp \
     include/Qube2D/Graphics/System/Base/IMovable.hpp \
     include/Qube2D/Graphics/System/Base/ITransformable.hpp \
+    include/Qube2D/Graphics/System/Base/ISpatial.hpp \
     include/Qube2D/Graphics/Sprite.hpp \
     include/Qube2D/Graphics/Background.hpp \
     include/Qube2D/Graphics/Animation.hpp \
+    include/Qube2D/Graphics/SpriteBatch.hpp \
+    include/Qube2D/Graphics/PrimitiveBatch.hpp \
+    include/Qube2D/Graphics/RenderQueue.hpp \
+    include/Qube2D/Graphics/SpatialIndex.hpp \
+    include/Qube2D/Graphics/TextureAtlas.hpp \
+    include/Qube2D/Graphics/PackedAtlas.hpp \
     include/Qube2D/Graphics/System/Structs/Frame.hpp \
+    include/Qube2D/Graphics/System/Structs/TextureRegion.hpp \
+    include/Qube2D/Graphics/System/Structs/AtlasFile.hpp \
     include/Qube2D/Graphics/System/GraphicsErrors.hpp \
     include/Qube2D/Graphics/Shapes/Line.hpp \
     include/Qube2D/Graphics/Shapes/Triangle.hpp \
@@ -120,10 +134,16 @@ HEADERS += \
     include/Qube2D/Graphics/Text/FontManager.hpp \
     include/Qube2D/Graphics/Text/TextErrors.hpp \
     include/Qube2D/Graphics/Text/Glyph.hpp \
+    include/Qube2D/Graphics/Text/GlyphTable.hpp \
+    include/Qube2D/Graphics/Text/LayoutCache.hpp \
+    include/Qube2D/Graphics/Text/GlyphRasterizer.hpp \
     include/Qube2D/Graphics/Text/Font.hpp \
     include/Qube2D/Graphics/Text/TextEnums.hpp \
     include/Qube2D/System/Storage/Atlas.hpp \
+    include/Qube2D/System/Storage/Guillotine.hpp \
+    include/Qube2D/System/Storage/Skyline.hpp \
     include/Qube2D/Graphics/Text.hpp \
+    include/Qube2D/Graphics/TextBatch.hpp \
     include/Qube2D/Graphics/System/Shader/TextShaders.hpp \
     #include/Qube2D/Audio/System/AudioManager.hpp \
     #include/Qube2D/Debug/ALCheck.hpp \
@@ -161,6 +181,8 @@ SOURCES += \
     src/Debug/GLCheck.cpp \
     src/Graphics/System/OpenGL/VertexArray.cpp \
     src/Graphics/System/OpenGL/VertexBuffer.cpp \
+    src/Graphics/System/OpenGL/StreamBuffer.cpp \
+    src/Graphics/System/OpenGL/GLState.cpp \
     src/Graphics/System/OpenGL/Shader.cpp \
     src/Graphics/System/OpenGL/ShaderProgram.cpp \
     deps/lodepng/lodepng.cpp \
@@ -170,8 +192,17 @@ SOURCES += \
     src/Graphics/System/Base/IFadable.cpp \
     src/Graphics/System/Base/IMovable.cpp \
     src/Graphics/System/Base/ITransformable.cpp \
+    src/Graphics/System/Base/ISpatial.cpp \
     src/Graphics/Background.cpp \
     src/Graphics/Animation.cpp \
+    src/Graphics/SpriteBatch.cpp \
+    src/Graphics/PrimitiveBatch.cpp \
+    src/Graphics/RenderQueue.cpp \
+    src/Graphics/SpatialIndex.cpp \
+    src/Graphics/TextureAtlas.cpp \
+    src/Graphics/PackedAtlas.cpp \
+    src/Graphics/System/QuadKernel.cpp \
+    src/Graphics/System/Culling.cpp \
     src/Graphics/Shapes/Line.cpp \
     src/Graphics/Shapes/Triangle.cpp \
     src/Graphics/Shapes/Rectangle.cpp \
@@ -181,7 +212,11 @@ SOURCES += \
     src/Graphics/Shapes/Arc.cpp \
     src/Graphics/Text/FontManager.cpp \
     src/Graphics/Text/Font.cpp \
+    src/Graphics/Text/GlyphTable.cpp \
+    src/Graphics/Text/LayoutCache.cpp \
+    src/Graphics/Text/GlyphRasterizer.cpp \
     src/Graphics/Text.cpp \
+    src/Graphics/TextBatch.cpp \
     #src/Debug/ALCheck.cpp \
     #src/Audio/System/AudioManager.cpp \
     #src/Audio/IAudio.cpp \
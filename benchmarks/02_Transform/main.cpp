@@ -0,0 +1,162 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/System/Base/IMovable.hpp>
+#include <Qube2D/Graphics/System/Base/ITransformable.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Benchmark settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int BENCH_OBJECTS    = 10000;
+const unsigned int BENCH_FRAMES     = 200;
+const float BENCH_WIDTH             = 800.f;
+const float BENCH_HEIGHT            = 600.f;
+
+
+///////////////////////////////////////////////////////////
+// Renderable stand-in; only the transform state is needed
+//
+///////////////////////////////////////////////////////////
+class Object : public Qube2D::IMovable, public Qube2D::ITransformable { };
+
+std::vector<Object> objects(BENCH_OBJECTS);
+volatile float sink = 0.f;
+
+
+///////////////////////////////////////////////////////////
+// Previous path: seven 4x4 matrices per object and frame
+//
+///////////////////////////////////////////////////////////
+void buildGlm(const Object &o, float *out)
+{
+    glm::mat4 identity      = glm::mat4(1.f);
+    glm::mat4 projection    = glm::ortho(0.f, BENCH_WIDTH, BENCH_HEIGHT, 0.f);
+    glm::mat4 translation   = glm::translate(identity, glm::vec3(o.x(), o.y(), 0.f));
+    glm::mat4 origin        = glm::translate(identity, glm::vec3(-o.originX(), -o.originY(), 0.f));
+    glm::mat4 rotation      = glm::rotate(identity, glm::radians(o.angle()), glm::vec3(0.f, 0.f, 1.f));
+    glm::mat4 iorigin       = glm::translate(identity, glm::vec3(o.originX(), o.originY(), 0.f));
+    glm::mat4 scaling       = glm::scale(identity, glm::vec3(o.scale(), o.scale(), 1.f));
+    glm::mat4 mvp           = projection * translation * iorigin * rotation * origin * scaling * identity;
+
+    const float *m = &mvp[0][0];
+    for (int i = 0; i < 16; i++)
+        out[i] = m[i];
+}
+
+///////////////////////////////////////////////////////////
+// Current path: cached affine transform and projection
+//
+///////////////////////////////////////////////////////////
+void buildCached(const Object &o, float *out)
+{
+    (Qube2D::m_Projection * o.transform().translated(o.x(), o.y())).toMatrix(out);
+}
+
+
+///////////////////////////////////////////////////////////
+/// Runs one phase and prints the average time per frame.
+///
+///////////////////////////////////////////////////////////
+void run(const char *name, bool dynamic, void (*build)(const Object &, float *))
+{
+    float mvp[16];
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (unsigned int f = 0; f < BENCH_FRAMES; f++)
+    {
+        for (unsigned int i = 0; i < BENCH_OBJECTS; i++)
+        {
+            Object &o = objects[i];
+            if (dynamic)
+                o.setRotation(o.angle() + 1.f);
+
+            build(o, mvp);
+            sink += mvp[0] + mvp[13];
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    std::cout << name << (dynamic ? " dynamic" : " static ")
+              << ": " << ms / BENCH_FRAMES << " ms/frame, "
+              << (ms * 1000000.0) / (BENCH_FRAMES * BENCH_OBJECTS)
+              << " ns/object" << std::endl;
+}
+
+
+///////////////////////////////////////////////////////////
+/// Entry point
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    // Equals IMovable::initializeView for a 800x600 viewport
+    Qube2D::m_WinW = BENCH_WIDTH;
+    Qube2D::m_WinH = BENCH_HEIGHT;
+    Qube2D::m_Projection.a  = 2.f / BENCH_WIDTH;
+    Qube2D::m_Projection.b  = 0.f;
+    Qube2D::m_Projection.c  = 0.f;
+    Qube2D::m_Projection.d  = -2.f / BENCH_HEIGHT;
+    Qube2D::m_Projection.tx = -1.f;
+    Qube2D::m_Projection.ty = 1.f;
+
+    for (unsigned int i = 0; i < BENCH_OBJECTS; i++)
+    {
+        objects[i].setPosition(static_cast<float>(i % 800), static_cast<float>(i % 600));
+        objects[i].setOrigin(16.f, 16.f);
+        objects[i].setRotation(static_cast<float>(i % 360));
+        objects[i].setScale(1.f + (i % 4) * 0.25f);
+    }
+
+    std::cout << BENCH_OBJECTS << " objects, "
+              << BENCH_FRAMES << " frames" << std::endl;
+
+    run("glm   ", false, buildGlm);
+    run("cached", false, buildCached);
+    run("glm   ", true, buildGlm);
+    run("cached", true, buildCached);
+
+    return 0;
+}
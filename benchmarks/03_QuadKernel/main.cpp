@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/System/QuadKernel.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Benchmark settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int BENCH_COUNTS[]   = { 1000, 10000, 50000 };
+const unsigned int BENCH_ROUNDS     = 200;
+const char *BENCH_LEVELS[]          = { "scalar", "sse2  ", "avx2  " };
+
+
+///////////////////////////////////////////////////////////
+/// Fills the list with randomly placed sprite quads.
+///
+///////////////////////////////////////////////////////////
+void fill(Qube2D::QuadList &list, unsigned int count)
+{
+    Qube2D::TextureVertices quad;
+    quad.v0.xy(0.f, 0.f);   quad.v0.uv(0.f, 0.f);
+    quad.v1.xy(32.f, 0.f);  quad.v1.uv(1.f, 0.f);
+    quad.v2.xy(32.f, 32.f); quad.v2.uv(1.f, 1.f);
+    quad.v3.xy(0.f, 32.f);  quad.v3.uv(0.f, 1.f);
+    quad.v0.rgba(1.f, 1.f, 1.f, 1.f);
+    quad.v1.rgba(1.f, 1.f, 1.f, 1.f);
+    quad.v2.rgba(1.f, 1.f, 1.f, 1.f);
+    quad.v3.rgba(1.f, 1.f, 1.f, 1.f);
+
+    list.resize(count);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        Qube2D::Transform t;
+        t.a = t.d = 0.8f;
+        t.b = 0.6f;
+        t.c = -0.6f;
+        t.tx = static_cast<float>(std::rand() % 800);
+        t.ty = static_cast<float>(std::rand() % 600);
+        list.set(i, t, quad, 1.f);
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// Entry point
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    Qube2D::SimdLevel best = Qube2D::QuadKernel::simdLevel();
+    std::cout << "widest ISA: " << BENCH_LEVELS[static_cast<int>(best)] << std::endl;
+
+    for (unsigned int count : BENCH_COUNTS)
+    {
+        Qube2D::QuadList list;
+        std::vector<Qube2D::TextureVertices> reference(count);
+        std::vector<Qube2D::TextureVertices> out(count);
+        fill(list, count);
+
+        Qube2D::QuadKernel::transform(list.arrays(), count,
+                reference.data(), Qube2D::SimdLevel::Scalar);
+
+        for (int l = 0; l <= static_cast<int>(best); l++)
+        {
+            Qube2D::SimdLevel level = static_cast<Qube2D::SimdLevel>(l);
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for (unsigned int r = 0; r < BENCH_ROUNDS; r++)
+                Qube2D::QuadKernel::transform(list.arrays(), count, out.data(), level);
+
+            auto end = std::chrono::high_resolution_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            bool same = std::memcmp(reference.data(), out.data(),
+                                    sizeof(Qube2D::TextureVertices) * count) == 0;
+
+            std::cout << count << " quads, " << BENCH_LEVELS[l] << ": "
+                      << ms / BENCH_ROUNDS << " ms, "
+                      << (ms * 1000000.0) / (BENCH_ROUNDS * count) << " ns/quad"
+                      << (same ? "" : " (MISMATCH)") << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,229 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Window/Window.hpp>
+#include <Qube2D/Graphics/Shapes/Circle.hpp>
+#include <Qube2D/Graphics/Shapes/Rectangle.hpp>
+#include <Qube2D/Graphics/PrimitiveBatch.hpp>
+#include "../Common/BenchHarness.hpp"
+#include <iostream>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Function declarations
+//
+///////////////////////////////////////////////////////////
+int main();
+void init();
+void exit();
+void update(double deltaTime);
+void render();
+
+
+///////////////////////////////////////////////////////////
+// Benchmark settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int BENCH_COUNTS[]   = { 1000, 5000, 20000 };
+const char *BENCH_MODES[]           = { "immediate", "batched" };
+
+
+///////////////////////////////////////////////////////////
+// Qube2D objects
+//
+///////////////////////////////////////////////////////////
+Qube2D::Window window;
+std::vector<Qube2D::Circle> circles;
+std::vector<Qube2D::Rectangle> rects;
+Qube2D::PrimitiveBatch batch;
+
+BenchHarness harness(BENCH_COUNTS, BENCH_MODES);
+unsigned int drawCalls = 0;
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      main
+/// \brief   Defines the main entry point for this app.
+///
+/// Renders 1k, 5k and 20k shapes (half circles, half
+/// rectangles; half of each filled), first one draw call
+/// per shape via IPrimitive::render, then through a
+/// PrimitiveBatch, and prints the draw calls and frame
+/// time of each phase. The filled shapes are drawn before
+/// the outlines, since the batch keeps submission order.
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    Qube2D::WindowSettings settings;
+
+    // ----------------------------
+    settings.setWindowPosRelative(Qube2D::WindowPosition::Center);
+    settings.setClearColor(Qube2D::Color(100, 149, 237));
+    settings.setWindowSize(Qube2D::SizeI(800, 600));
+    settings.setDoubleBuffer(true);
+    settings.setVerticalSync(false);
+    settings.setFullscreen(false);
+    settings.setTitle("04_PrimitiveBatch");
+
+    // ----------------------------
+    window.setInitializeFunction(init);
+    window.setExitFunction(exit);
+    window.setUpdateFunction(update);
+    window.setRenderFunction(render);
+    window.create(settings);
+    window.start();
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      init
+/// \brief   Initialization callback
+///
+///////////////////////////////////////////////////////////
+void init()
+{
+    unsigned int max = BENCH_COUNTS[2] / 2;
+    circles.resize(max);
+    rects.resize(max);
+
+    for (unsigned int i = 0; i < max; i++)
+    {
+        circles[i].create();
+        circles[i].setRadius(8.f);
+        circles[i].setColor(Qube2D::Color(255, 255, 255));
+        circles[i].setFilled(i % 2 == 0);
+        circles[i].setPosition((i * 37) % 784, (i * 53) % 584);
+
+        rects[i].create();
+        rects[i].setRect(Qube2D::RectF(0.f, 0.f, 16.f, 12.f));
+        rects[i].setColor(Qube2D::Color(255, 128, 128),
+                          Qube2D::Color(128, 255, 128),
+                          Qube2D::Color(128, 128, 255),
+                          Qube2D::Color(255, 255, 255));
+        rects[i].setFilled(i % 2 == 1);
+        rects[i].setPosition((i * 53) % 784, (i * 37) % 584);
+        rects[i].setRotation(static_cast<float>(i % 360));
+    }
+
+    batch.create();
+
+    harness.printHeader("shapes\tmode\t\tdraw calls");
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      exit
+/// \brief   Exit callback
+///
+///////////////////////////////////////////////////////////
+void exit()
+{
+    batch.destroy();
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      update
+/// \brief   Update callback; measures the frame time.
+///
+///////////////////////////////////////////////////////////
+void update(double deltaTime)
+{
+    if (harness.measure(deltaTime))
+    {
+        harness.row() << drawCalls << "\t\t";
+
+        if (harness.nextPhase())
+            window.stop();
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      render
+/// \brief   Render callback
+///
+///////////////////////////////////////////////////////////
+void render()
+{
+    if (harness.isDone())
+        return;
+
+    unsigned int count = harness.count() / 2;
+
+    if (harness.mode() == 0)
+    {
+        for (unsigned int pass = 0; pass < 2; pass++)
+        {
+            for (unsigned int i = pass; i < count; i += 2)
+                circles[i].render();
+            for (unsigned int i = 1 - pass; i < count; i += 2)
+                rects[i].render();
+        }
+
+        drawCalls = count * 2;
+    }
+    else
+    {
+        batch.begin();
+        for (unsigned int pass = 0; pass < 2; pass++)
+        {
+            for (unsigned int i = pass; i < count; i += 2)
+                batch.draw(circles[i]);
+            for (unsigned int i = 1 - pass; i < count; i += 2)
+                batch.draw(rects[i]);
+        }
+        batch.end();
+
+        drawCalls = batch.drawCalls();
+    }
+
+    harness.frameRendered();
+}
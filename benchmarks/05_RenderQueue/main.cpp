@@ -0,0 +1,224 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Window/Window.hpp>
+#include <Qube2D/Graphics/Sprite.hpp>
+#include <Qube2D/Graphics/SpriteBatch.hpp>
+#include <Qube2D/Graphics/RenderQueue.hpp>
+#include "../Common/BenchHarness.hpp"
+#include <iostream>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Function declarations
+//
+///////////////////////////////////////////////////////////
+int main();
+void init();
+void exit();
+void update(double deltaTime);
+void render();
+
+
+///////////////////////////////////////////////////////////
+// Benchmark settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int BENCH_COUNTS[]   = { 1000, 10000, 50000 };
+const unsigned int BENCH_TEXTURES   = 4;
+const char *BENCH_MODES[]           = { "submission", "queue" };
+
+
+///////////////////////////////////////////////////////////
+// Qube2D objects
+//
+///////////////////////////////////////////////////////////
+Qube2D::Window window;
+Qube2D::Texture textures[BENCH_TEXTURES];
+std::vector<Qube2D::Sprite> sprites;
+Qube2D::SpriteBatch batch;
+Qube2D::RenderQueue queue;
+
+BenchHarness harness(BENCH_COUNTS, BENCH_MODES);
+unsigned int drawCalls = 0;
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      main
+/// \brief   Defines the main entry point for this app.
+///
+/// Renders 1k, 10k and 50k opaque sprites whose textures
+/// interleave, first through a SpriteBatch in submission
+/// order, then through a RenderQueue, which groups those
+/// not overlapping each other by texture, and prints the
+/// draw calls and frame time.
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    Qube2D::WindowSettings settings;
+
+    // ----------------------------
+    settings.setWindowPosRelative(Qube2D::WindowPosition::Center);
+    settings.setClearColor(Qube2D::Color(100, 149, 237));
+    settings.setWindowSize(Qube2D::SizeI(800, 600));
+    settings.setDoubleBuffer(true);
+    settings.setVerticalSync(false);
+    settings.setFullscreen(false);
+    settings.setTitle("05_RenderQueue");
+
+    // ----------------------------
+    window.setInitializeFunction(init);
+    window.setExitFunction(exit);
+    window.setUpdateFunction(update);
+    window.setRenderFunction(render);
+    window.create(settings);
+    window.start();
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      init
+/// \brief   Initialization callback
+///
+///////////////////////////////////////////////////////////
+void init()
+{
+    const Qube2D::Color colors[BENCH_TEXTURES] =
+    {
+        Qube2D::Color(255, 255, 255),
+        Qube2D::Color(255, 128, 128),
+        Qube2D::Color(128, 255, 128),
+        Qube2D::Color(128, 128, 255)
+    };
+
+    for (unsigned int i = 0; i < BENCH_TEXTURES; i++)
+        textures[i].create(16, 16, Qube2D::TextureFormat::FormatRGBA, colors[i]);
+
+    // Worst case for batching: every sprite switches texture
+    unsigned int max = BENCH_COUNTS[2];
+    sprites.resize(max);
+    for (unsigned int i = 0; i < max; i++)
+    {
+        sprites[i].create();
+        sprites[i].load(textures[i % BENCH_TEXTURES]);
+        sprites[i].setPosition((i * 37) % 784, (i * 53) % 584);
+    }
+
+    batch.create();
+    queue.create();
+
+    harness.printHeader("sprites\tmode\t\tdraw calls");
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      exit
+/// \brief   Exit callback
+///
+///////////////////////////////////////////////////////////
+void exit()
+{
+    batch.destroy();
+    queue.destroy();
+
+    for (unsigned int i = 0; i < BENCH_TEXTURES; i++)
+        textures[i].destroy();
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      update
+/// \brief   Update callback; measures the frame time.
+///
+///////////////////////////////////////////////////////////
+void update(double deltaTime)
+{
+    if (harness.measure(deltaTime))
+    {
+        harness.row() << drawCalls << "\t\t";
+
+        if (harness.nextPhase())
+            window.stop();
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      render
+/// \brief   Render callback
+///
+///////////////////////////////////////////////////////////
+void render()
+{
+    if (harness.isDone())
+        return;
+
+    unsigned int count = harness.count();
+
+    if (harness.mode() == 0)
+    {
+        batch.begin();
+        for (unsigned int i = 0; i < count; i++)
+            batch.draw(sprites[i]);
+        batch.end();
+
+        drawCalls = batch.drawCalls();
+    }
+    else
+    {
+        for (unsigned int i = 0; i < count; i++)
+            queue.submit(sprites[i]);
+        queue.execute();
+
+        drawCalls = queue.drawCalls();
+    }
+
+    harness.frameRendered();
+}
@@ -0,0 +1,200 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Window/Window.hpp>
+#include <Qube2D/Graphics/Sprite.hpp>
+#include <Qube2D/Graphics/SpriteBatch.hpp>
+#include <Qube2D/Graphics/System/Culling.hpp>
+#include "../Common/BenchHarness.hpp"
+#include <iostream>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Function declarations
+//
+///////////////////////////////////////////////////////////
+int main();
+void init();
+void exit();
+void update(double deltaTime);
+void render();
+
+
+///////////////////////////////////////////////////////////
+// Benchmark settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int BENCH_COUNTS[]   = { 10000, 50000 };
+const unsigned int BENCH_WORLD      = 4;
+const char *BENCH_MODES[]           = { "off", "on" };
+
+
+///////////////////////////////////////////////////////////
+// Qube2D objects
+//
+///////////////////////////////////////////////////////////
+Qube2D::Window window;
+Qube2D::Texture texture;
+std::vector<Qube2D::Sprite> sprites;
+Qube2D::SpriteBatch batch;
+
+BenchHarness harness(BENCH_COUNTS, BENCH_MODES);
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      main
+/// \brief   Defines the main entry point for this app.
+///
+/// Scatters 10k and 50k rotated sprites over an area four
+/// times the window size in each direction, so that only
+/// a sixteenth of them is visible, and renders them with
+/// culling disabled and enabled. Prints the cull counters
+/// of the last frame and the frame time.
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    Qube2D::WindowSettings settings;
+
+    // ----------------------------
+    settings.setWindowPosRelative(Qube2D::WindowPosition::Center);
+    settings.setClearColor(Qube2D::Color(100, 149, 237));
+    settings.setWindowSize(Qube2D::SizeI(800, 600));
+    settings.setDoubleBuffer(true);
+    settings.setVerticalSync(false);
+    settings.setFullscreen(false);
+    settings.setTitle("06_Culling");
+
+    // ----------------------------
+    window.setInitializeFunction(init);
+    window.setExitFunction(exit);
+    window.setUpdateFunction(update);
+    window.setRenderFunction(render);
+    window.create(settings);
+    window.start();
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      init
+/// \brief   Initialization callback
+///
+///////////////////////////////////////////////////////////
+void init()
+{
+    texture.create(16, 16, Qube2D::TextureFormat::FormatRGBA, Qube2D::Color(255, 255, 255));
+
+    unsigned int max = BENCH_COUNTS[1];
+    sprites.resize(max);
+    for (unsigned int i = 0; i < max; i++)
+    {
+        sprites[i].create();
+        sprites[i].load(texture);
+        sprites[i].setPosition((i * 37) % (800 * BENCH_WORLD), (i * 53) % (600 * BENCH_WORLD));
+        sprites[i].setRotation(static_cast<float>(i % 360));
+    }
+
+    batch.create();
+
+    harness.printHeader("sprites\tculling\ttested\tculled");
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      exit
+/// \brief   Exit callback
+///
+///////////////////////////////////////////////////////////
+void exit()
+{
+    batch.destroy();
+    texture.destroy();
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      update
+/// \brief   Update callback; measures the frame time.
+///
+///////////////////////////////////////////////////////////
+void update(double deltaTime)
+{
+    if (harness.measure(deltaTime))
+    {
+        const Qube2D::CullStats &stats = Qube2D::Culling::stats();
+        harness.row() << stats.tested << "\t"
+                      << stats.culled << "\t";
+
+        if (harness.nextPhase())
+            window.stop();
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      render
+/// \brief   Render callback
+///
+///////////////////////////////////////////////////////////
+void render()
+{
+    if (harness.isDone())
+        return;
+
+    unsigned int count = harness.count();
+    Qube2D::Culling::setEnabled(harness.mode() == 1);
+
+    batch.begin();
+    for (unsigned int i = 0; i < count; i++)
+        batch.draw(sprites[i]);
+    batch.end();
+
+    harness.frameRendered();
+}
@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/SpatialIndex.hpp>
+#include <Qube2D/Graphics/Shapes/Rectangle.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Benchmark settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int BENCH_OBJECTS    = 20000;
+const unsigned int BENCH_MOVING     = 2000;
+const unsigned int BENCH_PICKS      = 100;
+const unsigned int BENCH_FRAMES     = 200;
+const unsigned int BENCH_WORLD      = 8;
+const float BENCH_WIDTH             = 800.f;
+const float BENCH_HEIGHT            = 600.f;
+
+
+///////////////////////////////////////////////////////////
+// Shapes need no OpenGL context to compute their bounds
+//
+///////////////////////////////////////////////////////////
+std::vector<Qube2D::Rectangle> shapes(BENCH_OBJECTS);
+std::vector<Qube2D::ISpatial *> found;
+Qube2D::SpatialIndex grid(64.f);
+unsigned int frame = 0;
+volatile unsigned int sink = 0;
+
+
+///////////////////////////////////////////////////////////
+// Moves a tenth of the shapes, like a typical game update
+//
+///////////////////////////////////////////////////////////
+void move()
+{
+    for (unsigned int i = 0; i < BENCH_MOVING; i++)
+    {
+        Qube2D::Rectangle &r = shapes[(frame * BENCH_MOVING + i) % BENCH_OBJECTS];
+        float x = r.x() + 3.f, y = r.y() + 2.f;
+        if (x > BENCH_WIDTH * BENCH_WORLD) x = 0.f;
+        if (y > BENCH_HEIGHT * BENCH_WORLD) y = 0.f;
+        r.setPosition(x, y);
+    }
+
+    frame++;
+}
+
+///////////////////////////////////////////////////////////
+// Previous path: tests the bounds of every shape
+//
+///////////////////////////////////////////////////////////
+void queryLinear(const Qube2D::RectF &area, bool point)
+{
+    for (unsigned int i = 0; i < BENCH_OBJECTS; i++)
+    {
+        Qube2D::RectF b = shapes[i].bounds();
+        bool hit = point
+                ? area.x() >= b.x() && area.x() < b.x() + b.width() &&
+                  area.y() >= b.y() && area.y() < b.y() + b.height()
+                : area.x() <= b.x() + b.width() && b.x() <= area.x() + area.width() &&
+                  area.y() <= b.y() + b.height() && b.y() <= area.y() + area.height();
+
+        if (hit)
+            found.push_back(&shapes[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////
+// Current path: asks the spatial index
+//
+///////////////////////////////////////////////////////////
+void queryGrid(const Qube2D::RectF &area, bool point)
+{
+    if (point)
+        grid.query(area.x(), area.y(), found);
+    else
+        grid.query(area, found);
+}
+
+
+///////////////////////////////////////////////////////////
+/// Runs one phase and prints the average time per frame.
+///
+///////////////////////////////////////////////////////////
+void run(const char *name, void (*query)(const Qube2D::RectF &, bool))
+{
+    // Both phases start from the same layout
+    for (unsigned int i = 0; i < BENCH_OBJECTS; i++)
+    {
+        shapes[i].setPosition(static_cast<float>((i * 37) % (800 * BENCH_WORLD)),
+                              static_cast<float>((i * 53) % (600 * BENCH_WORLD)));
+    }
+
+    frame = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (unsigned int f = 0; f < BENCH_FRAMES; f++)
+    {
+        move();
+
+        // One visible set and a few mouse picks per frame
+        found.clear();
+        query(Qube2D::RectF(0.f, 0.f, BENCH_WIDTH, BENCH_HEIGHT), false);
+        for (unsigned int p = 0; p < BENCH_PICKS; p++)
+            query(Qube2D::RectF((p * 97) % 800, (p * 61) % 600, 0.f, 0.f), true);
+
+        sink += static_cast<unsigned int>(found.size());
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    std::cout << name << ": " << ms / BENCH_FRAMES << " ms/frame, "
+              << found.size() << " results" << std::endl;
+}
+
+
+///////////////////////////////////////////////////////////
+/// Entry point
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    for (unsigned int i = 0; i < BENCH_OBJECTS; i++)
+    {
+        shapes[i].setRect(Qube2D::RectF(0.f, 0.f, 24.f, 24.f));
+        shapes[i].setRotation(static_cast<float>(i % 360));
+    }
+
+    std::cout << BENCH_OBJECTS << " objects, "
+              << BENCH_MOVING << " moving, "
+              << BENCH_FRAMES << " frames" << std::endl;
+
+    run("linear", queryLinear);
+
+    for (unsigned int i = 0; i < BENCH_OBJECTS; i++)
+        grid.insert(&shapes[i]);
+
+    run("grid  ", queryGrid);
+
+    return 0;
+}
@@ -0,0 +1,199 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Window/Window.hpp>
+#include <Qube2D/Graphics/Text.hpp>
+#include <Qube2D/Graphics/Text/FontManager.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+
+///////////////////////////////////////////////////////////
+// Function declarations
+//
+///////////////////////////////////////////////////////////
+int main();
+void init();
+void exit();
+void update(double deltaTime);
+void render();
+
+
+///////////////////////////////////////////////////////////
+// Benchmark settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int BENCH_LENGTH     = 10000;
+const unsigned int BENCH_RUNS       = 50;
+const unsigned int BENCH_SIZE       = 16;
+const char *BENCH_NAMES[]           = { "ascii   ", "latin-1 ", "cyrillic" };
+const char32_t BENCH_FIRST[]        = { 0x21, 0xA1, 0x410 };
+const char32_t BENCH_RANGE[]        = { 0x5E, 0x5F, 0x40 };
+
+
+///////////////////////////////////////////////////////////
+// Qube2D objects
+//
+///////////////////////////////////////////////////////////
+Qube2D::Window window;
+Qube2D::Font *font = NULL;
+Qube2D::Text text;
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      main
+/// \brief   Defines the main entry point for this app.
+///
+/// Lays out 10k-character strings of Basic Latin, Latin-1
+/// and Cyrillic characters with Text::setText once all of
+/// their glyphs are cached, and prints the average time per
+/// call. Cyrillic glyphs are looked up through the hash
+/// table, the others through the direct table.
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    Qube2D::WindowSettings settings;
+
+    // ----------------------------
+    settings.setWindowPosRelative(Qube2D::WindowPosition::Center);
+    settings.setClearColor(Qube2D::Color(100, 149, 237));
+    settings.setWindowSize(Qube2D::SizeI(800, 600));
+    settings.setDoubleBuffer(true);
+    settings.setVerticalSync(false);
+    settings.setFullscreen(false);
+    settings.setTitle("08_SetText");
+
+    // ----------------------------
+    window.setInitializeFunction(init);
+    window.setExitFunction(exit);
+    window.setUpdateFunction(update);
+    window.setRenderFunction(render);
+    window.create(settings);
+    window.start();
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      init
+/// \brief   Initialization callback; runs the benchmark.
+///
+///////////////////////////////////////////////////////////
+void init()
+{
+    font = Qube2D::FontManager::loadFont("../../examples/06_Text/Arial.ttf");
+    text.create();
+    text.setFont(font);
+    text.setTextSize(BENCH_SIZE);
+
+    std::cout << "script\t\tms/setText" << std::endl;
+
+    for (unsigned int s = 0; s < 3; s++)
+    {
+        // Words of six characters, 80 characters per line
+        std::u32string chars;
+        for (unsigned int i = 0; i < BENCH_LENGTH; i++)
+        {
+            if (i % 80 == 79)
+                chars.push_back(U'\n');
+            else if (i % 7 == 6)
+                chars.push_back(U' ');
+            else
+                chars.push_back(BENCH_FIRST[s] + (i * 31) % BENCH_RANGE[s]);
+        }
+
+        // Caches all glyphs before measuring
+        Qube2D::String string(chars.c_str());
+        text.setText(string);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (unsigned int r = 0; r < BENCH_RUNS; r++)
+            text.setText(string);
+
+        auto end = std::chrono::high_resolution_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+        std::cout << BENCH_NAMES[s] << "\t" << ms / BENCH_RUNS << std::endl;
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      exit
+/// \brief   Exit callback
+///
+///////////////////////////////////////////////////////////
+void exit()
+{
+    text.destroy();
+    Qube2D::FontManager::unloadFont(font);
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      update
+/// \brief   Update callback; the benchmark ran in init.
+///
+///////////////////////////////////////////////////////////
+void update(double)
+{
+    window.stop();
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      render
+/// \brief   Render callback
+///
+///////////////////////////////////////////////////////////
+void render()
+{
+    text.render();
+}
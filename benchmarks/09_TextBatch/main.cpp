@@ -0,0 +1,222 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Window/Window.hpp>
+#include <Qube2D/Graphics/Text.hpp>
+#include <Qube2D/Graphics/TextBatch.hpp>
+#include <Qube2D/Graphics/Text/FontManager.hpp>
+#include "../Common/BenchHarness.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Function declarations
+//
+///////////////////////////////////////////////////////////
+int main();
+void init();
+void exit();
+void update(double deltaTime);
+void render();
+
+
+///////////////////////////////////////////////////////////
+// Benchmark settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int BENCH_COUNTS[]   = { 100, 300, 1000 };
+const unsigned int BENCH_SIZE       = 14;
+const char *BENCH_MODES[]           = { "immediate", "batched" };
+
+
+///////////////////////////////////////////////////////////
+// Qube2D objects
+//
+///////////////////////////////////////////////////////////
+Qube2D::Window window;
+Qube2D::Font *font = NULL;
+std::vector<Qube2D::Text> labels;
+Qube2D::TextBatch batch;
+
+BenchHarness harness(BENCH_COUNTS, BENCH_MODES);
+unsigned int drawCalls = 0;
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      main
+/// \brief   Defines the main entry point for this app.
+///
+/// Renders 100, 300 and 1000 HUD labels sharing one font,
+/// every other one with a drop shadow. First every label
+/// is drawn via Text::render, then through a TextBatch.
+/// Prints the draw calls and frame time of each phase.
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    Qube2D::WindowSettings settings;
+
+    // ----------------------------
+    settings.setWindowPosRelative(Qube2D::WindowPosition::Center);
+    settings.setClearColor(Qube2D::Color(100, 149, 237));
+    settings.setWindowSize(Qube2D::SizeI(800, 600));
+    settings.setDoubleBuffer(true);
+    settings.setVerticalSync(false);
+    settings.setFullscreen(false);
+    settings.setTitle("09_TextBatch");
+
+    // ----------------------------
+    window.setInitializeFunction(init);
+    window.setExitFunction(exit);
+    window.setUpdateFunction(update);
+    window.setRenderFunction(render);
+    window.create(settings);
+    window.start();
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      init
+/// \brief   Initialization callback
+///
+///////////////////////////////////////////////////////////
+void init()
+{
+    font = Qube2D::FontManager::loadFont("../../examples/06_Text/Arial.ttf");
+    labels.resize(BENCH_COUNTS[2]);
+
+    for (unsigned int i = 0; i < BENCH_COUNTS[2]; i++)
+    {
+        std::string number = std::to_string(i);
+        std::u32string chars = U"Label ";
+        chars.append(number.begin(), number.end());
+
+        Qube2D::Text &label = labels[i];
+        label.create();
+        label.setFont(font);
+        label.setTextSize(BENCH_SIZE);
+        label.setColor(Qube2D::Color(255, 255, 255));
+        label.setShadowOffset(1.f, 1.f);
+        label.setText(Qube2D::String(chars.c_str()),
+                      (i % 2 == 0) ? Qube2D::TextStyle::DropShadow
+                                   : Qube2D::TextStyle::Regular);
+        label.setPosition((i * 97) % 720, (i * 23) % 580);
+    }
+
+    batch.create();
+
+    harness.printHeader("labels\tmode\t\tdraw calls");
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      exit
+/// \brief   Exit callback
+///
+///////////////////////////////////////////////////////////
+void exit()
+{
+    batch.destroy();
+    for (auto &label : labels)
+        label.destroy();
+
+    Qube2D::FontManager::unloadFont(font);
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      update
+/// \brief   Update callback; measures the frame time.
+///
+///////////////////////////////////////////////////////////
+void update(double deltaTime)
+{
+    if (harness.measure(deltaTime))
+    {
+        harness.row() << drawCalls << "\t\t";
+
+        if (harness.nextPhase())
+            window.stop();
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 16th, 2026
+/// \fn      render
+/// \brief   Render callback
+///
+///////////////////////////////////////////////////////////
+void render()
+{
+    if (harness.isDone())
+        return;
+
+    unsigned int count = harness.count();
+
+    if (harness.mode() == 0)
+    {
+        // Shadowed labels issue a second draw call
+        for (unsigned int i = 0; i < count; i++)
+            labels[i].render();
+
+        drawCalls = count + (count + 1) / 2;
+    }
+    else
+    {
+        batch.begin();
+        for (unsigned int i = 0; i < count; i++)
+            batch.draw(labels[i]);
+        batch.end();
+
+        drawCalls = batch.drawCalls();
+    }
+
+    harness.frameRendered();
+}
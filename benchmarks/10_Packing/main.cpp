@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/System/Storage/Atlas.hpp>
+#include <Qube2D/System/Storage/Guillotine.hpp>
+#include <Qube2D/System/Storage/Skyline.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Benchmark settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int BENCH_PAGE       = 2048;
+const unsigned int BENCH_GLYPHS     = 12000;
+const unsigned int BENCH_SPRITES    = 400;
+const unsigned int BENCH_REPEATS    = 3;
+
+
+///////////////////////////////////////////////////////////
+// Sizes to pack, generated once for all packers
+//
+///////////////////////////////////////////////////////////
+std::vector<Qube2D::RectI> glyphs;
+std::vector<Qube2D::RectI> sprites;
+unsigned int seed = 12345;
+
+
+///////////////////////////////////////////////////////////
+/// Deterministic pseudo-random number in [min, max].
+///
+///////////////////////////////////////////////////////////
+int random(int min, int max)
+{
+    seed = seed * 1103515245u + 12345u;
+    return min + static_cast<int>((seed >> 16) % static_cast<unsigned int>(max - min + 1));
+}
+
+///////////////////////////////////////////////////////////
+/// Glyphs: small, taller than wide, many similar sizes.
+/// Sprites: few, large, often square or power-of-two sided.
+///
+///////////////////////////////////////////////////////////
+void generate()
+{
+    for (unsigned int i = 0; i < BENCH_GLYPHS; i++)
+    {
+        int size = random(10, 36);
+        glyphs.push_back(Qube2D::RectI(0, 0, random(size / 3, size), random(size / 2, size + 8)));
+    }
+
+    for (unsigned int i = 0; i < BENCH_SPRITES; i++)
+    {
+        int w = random(16, 256), h = random(16, 256);
+        if (i % 3 == 0) h = w;
+        if (i % 4 == 0) w = h = 1 << random(4, 8);
+        sprites.push_back(Qube2D::RectI(0, 0, w, h));
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// Packs all rectangles into one page, in the given order,
+/// and prints the throughput and the occupied space.
+///
+///////////////////////////////////////////////////////////
+template <typename T>
+void run(const char *name, const std::vector<Qube2D::RectI> &rects)
+{
+    unsigned long long area = 0;
+    unsigned int placed = 0;
+    double ms = 0.0;
+
+    for (unsigned int r = 0; r < BENCH_REPEATS; r++)
+    {
+        T packer;
+        area = 0;
+        placed = 0;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto it = rects.begin(); it != rects.end(); ++it)
+        {
+            Qube2D::RectI space = packer.find(it->width(), it->height());
+            if (!space.isValid())
+                continue;
+
+            area += static_cast<unsigned long long>(space.width()) * space.height();
+            placed++;
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        ms += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    ms /= BENCH_REPEATS;
+    std::cout << name << ": " << ms << " ms, "
+              << placed << "/" << rects.size() << " placed, "
+              << (placed / ms) << " rects/ms, "
+              << (100.0 * area / (double(BENCH_PAGE) * BENCH_PAGE)) << "% occupied" << std::endl;
+}
+
+
+///////////////////////////////////////////////////////////
+/// Entry point
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    generate();
+
+    std::cout << "glyphs (" << BENCH_GLYPHS << ")" << std::endl;
+    run<Qube2D::Atlas<BENCH_PAGE> >("  maxrects  ", glyphs);
+    run<Qube2D::Skyline<BENCH_PAGE> >("  skyline   ", glyphs);
+    run<Qube2D::Guillotine<BENCH_PAGE> >("  guillotine", glyphs);
+
+    std::cout << "sprites (" << BENCH_SPRITES << ")" << std::endl;
+    run<Qube2D::Atlas<BENCH_PAGE> >("  maxrects  ", sprites);
+    run<Qube2D::Skyline<BENCH_PAGE> >("  skyline   ", sprites);
+    run<Qube2D::Guillotine<BENCH_PAGE> >("  guillotine", sprites);
+
+    return 0;
+}
@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef __Q2D_BENCHHARNESS_HPP__
+#define __Q2D_BENCHHARNESS_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <iostream>
+
+
+///////////////////////////////////////////////////////////
+// Harness settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int BENCH_WARMUP     = 30;
+const unsigned int BENCH_FRAMES     = 300;
+
+
+///////////////////////////////////////////////////////////
+/// \file    BenchHarness.hpp
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 17th, 2026
+/// \class   BenchHarness
+/// \brief   Runs every mode of a benchmark for every count.
+///
+/// Each combination of count and mode is one phase. A phase
+/// renders BENCH_WARMUP frames, then measures BENCH_FRAMES
+/// frames and prints one row: the count, the mode, the
+/// columns of the benchmark and the average frame time.
+///
+/// The update callback calls measure and, once it returns
+/// TRUE, streams its own columns into row and calls
+/// nextPhase. The render callback reads count and mode and
+/// calls frameRendered.
+///
+///////////////////////////////////////////////////////////
+class BenchHarness
+{
+
+public:
+
+    ///////////////////////////////////////////////////////////
+    /// \fn     Constructor
+    /// \brief  Initializes the harness with its phases.
+    /// \param  counts Object counts, from smallest to largest
+    /// \param  modes Names of the modes to compare
+    ///
+    ///////////////////////////////////////////////////////////
+    template <unsigned int C, unsigned int M>
+    BenchHarness(const unsigned int (&counts)[C], const char *(&modes)[M])
+        : m_Counts(counts),
+          m_Modes(modes),
+          m_CountSize(C),
+          m_ModeSize(M),
+          m_Phase(0),
+          m_Frame(0),
+          m_FrameTime(0.0)
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \fn     printHeader
+    /// \brief  Prints the column titles.
+    /// \param  columns Titles up to, excluding the frame time
+    ///
+    ///////////////////////////////////////////////////////////
+    void printHeader(const char *columns) const
+    {
+        std::cout << columns << "\tframe ms" << std::endl;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       isDone -> const
+    /// \brief    Determines whether all phases were measured.
+    /// \returns  TRUE if the benchmark is over.
+    ///
+    ///////////////////////////////////////////////////////////
+    bool isDone() const
+    {
+        return m_Phase >= m_CountSize * m_ModeSize;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       isWarmingUp -> const
+    /// \brief    Determines whether the phase is not measured yet.
+    /// \returns  TRUE during the warmup frames.
+    ///
+    ///////////////////////////////////////////////////////////
+    bool isWarmingUp() const
+    {
+        return m_Frame <= BENCH_WARMUP;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       count -> const
+    /// \brief    Retrieves the object count of the phase.
+    /// \returns  the count to render.
+    ///
+    ///////////////////////////////////////////////////////////
+    unsigned int count() const
+    {
+        return m_Counts[m_Phase / m_ModeSize];
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       mode -> const
+    /// \brief    Retrieves the mode of the phase.
+    /// \returns  the index into the modes.
+    ///
+    ///////////////////////////////////////////////////////////
+    unsigned int mode() const
+    {
+        return m_Phase % m_ModeSize;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       measure
+    /// \brief    Adds the frame time once warmed up.
+    /// \param    deltaTime Time of the last frame, in seconds
+    /// \returns  TRUE if the phase is complete.
+    ///
+    ///////////////////////////////////////////////////////////
+    bool measure(double deltaTime)
+    {
+        if (isDone())
+            return false;
+
+        if (m_Frame > BENCH_WARMUP)
+            m_FrameTime += deltaTime;
+
+        return m_Frame == BENCH_WARMUP + BENCH_FRAMES;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       row
+    /// \brief    Starts the row of the completed phase.
+    /// \returns  the stream to append the columns to.
+    ///
+    ///////////////////////////////////////////////////////////
+    std::ostream &row() const
+    {
+        return std::cout << count() << "\t" << m_Modes[mode()] << "\t";
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       nextPhase
+    /// \brief    Ends the row and moves on to the next phase.
+    /// \returns  TRUE if that was the last phase.
+    ///
+    ///////////////////////////////////////////////////////////
+    bool nextPhase()
+    {
+        std::cout << (m_FrameTime * 1000.0 / BENCH_FRAMES) << std::endl;
+
+        m_Frame = 0;
+        m_FrameTime = 0.0;
+        m_Phase++;
+
+        return isDone();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn     frameRendered
+    /// \brief  Counts a frame of the current phase.
+    ///
+    ///////////////////////////////////////////////////////////
+    void frameRendered()
+    {
+        m_Frame++;
+    }
+
+
+private:
+
+    ///////////////////////////////////////////////////////////
+    // Class members
+    //
+    ///////////////////////////////////////////////////////////
+    const unsigned int *m_Counts;   ///< Object counts
+    const char **m_Modes;           ///< Mode names
+    unsigned int m_CountSize;       ///< Amount of counts
+    unsigned int m_ModeSize;        ///< Amount of modes
+    unsigned int m_Phase;           ///< Current phase
+    unsigned int m_Frame;           ///< Frame within the phase
+    double m_FrameTime;             ///< Measured seconds
+
+};
+
+
+#endif  // __Q2D_BENCHHARNESS_HPP__
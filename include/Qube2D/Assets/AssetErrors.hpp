@@ -47,6 +47,7 @@ namespace Qube2D
     /// Q2D_ASSETS_ERROR_2
     /// Q2D_ASSETS_ERROR_3
     /// Q2D_ASSETS_ERROR_4
+    /// Q2D_ASSETS_ERROR_5
     ///
     ///////////////////////////////////////////////////////////
 
@@ -55,6 +56,7 @@ namespace Qube2D
     #define Q2D_ASSETS_ERROR_2 "The text file has an invalid encoding. Please check the BOM header.\n    Path: %0"
     #define Q2D_ASSETS_ERROR_3 "The path of the current executable could not be found."
     #define Q2D_ASSETS_ERROR_4 "There are no files that match the given conditions\n    in folder '%0'."
+    #define Q2D_ASSETS_ERROR_5 "The file does not exist, is empty or could not be mapped into memory.\n    Path: %0"
 }
 
 
@@ -97,6 +97,27 @@ namespace Qube2D
                                          const char *extension,
                                          unsigned int *count) const = 0;
 
+        ///////////////////////////////////////////////////////////
+        /// \fn      mapFile -> virtual const
+        /// \brief   Maps a whole file read-only into memory.
+        /// \param   path Absolute file path
+        /// \param   (out) size Size of the file, in bytes
+        /// \returns the mapped file contents or NULL on failure.
+        ///
+        ///////////////////////////////////////////////////////////
+        virtual const QUInt8 *mapFile(const char *path,
+                                      QUInt32 *size) const = 0;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn      unmapFile -> virtual const
+        /// \brief   Unmaps a file mapped by AssetManager::mapFile.
+        /// \param   data Mapped file contents
+        /// \param   size Size of the file, in bytes
+        ///
+        ///////////////////////////////////////////////////////////
+        virtual void unmapFile(const QUInt8 *data,
+                               QUInt32 size) const = 0;
+
     protected:
 
         ///////////////////////////////////////////////////////////
@@ -115,6 +115,25 @@ namespace Qube2D
                                         const char *extension,
                                         unsigned int *count);
 
+        ///////////////////////////////////////////////////////////
+        /// \fn      mapFile -> static
+        /// \brief   Maps a whole file read-only into memory.
+        /// \param   path Relative-or-absolute asset path
+        /// \param   (out) size Size of the file, in bytes
+        /// \returns the mapped file contents or NULL on failure.
+        ///
+        ///////////////////////////////////////////////////////////
+        static const QUInt8 *mapFile(const char *path, QUInt32 *size);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn      unmapFile -> static
+        /// \brief   Unmaps a file mapped by Assets::mapFile.
+        /// \param   data Mapped file contents
+        /// \param   size Size of the file, in bytes
+        ///
+        ///////////////////////////////////////////////////////////
+        static void unmapFile(const QUInt8 *data, QUInt32 size);
+
 
         ///////////////////////////////////////////////////////////
         /// \fn      load<T> -> static
@@ -96,6 +96,25 @@ namespace Qube2D
             unsigned int  *count
         ) const;
 
+        ///////////////////////////////////////////////////////////
+        /// \fn      mapFile -> implemented
+        /// \brief   Maps a whole file read-only into memory.
+        /// \param   path Absolute file path
+        /// \param   (out) size Size of the file, in bytes
+        /// \returns the mapped file contents or NULL on failure.
+        ///
+        ///////////////////////////////////////////////////////////
+        const QUInt8 *mapFile(const char *path, QUInt32 *size) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn      unmapFile -> implemented
+        /// \brief   Unmaps a file mapped by Win32AssetManager::mapFile.
+        /// \param   data Mapped file contents
+        /// \param   size Size of the file, in bytes
+        ///
+        ///////////////////////////////////////////////////////////
+        void unmapFile(const QUInt8 *data, QUInt32 size) const;
+
     };
 }
 
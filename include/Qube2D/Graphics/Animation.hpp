@@ -107,6 +107,14 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         void render();
 
+        ///////////////////////////////////////////////////////////
+        /// \fn       isVisible
+        /// \brief    Determines whether a frame is to be drawn.
+        /// \returns  false if in "Halt" mode.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool isVisible() const;
+
 
     private:
 
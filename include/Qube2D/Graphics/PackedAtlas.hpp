@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_PACKEDATLAS_HPP__
+#define __Q2D_PACKEDATLAS_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Uncopyable.hpp>
+#include <Qube2D/Graphics/System/OpenGL/Texture.hpp>
+#include <Qube2D/Graphics/System/Structs/AtlasFile.hpp>
+#include <Qube2D/Graphics/System/Structs/TextureRegion.hpp>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    PackedAtlas.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   PackedAtlas : Uncopyable
+    /// \brief   Provides the images of a .qatlas file.
+    ///
+    /// The file, as written by the AtlasPacker tool, stays
+    /// memory-mapped while the atlas is open. Only the pages
+    /// are decoded upon opening; the images are located by
+    /// binary-searching the hash of their name in the mapped
+    /// entry table. See AtlasFile.hpp for the file layout.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API PackedAtlas : Uncopyable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of Qube2D::PackedAtlas.
+        ///
+        ///////////////////////////////////////////////////////////
+        PackedAtlas();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       open
+        /// \brief    Maps the file and uploads its pages.
+        /// \param    path Relative or absolute path to the .qatlas file
+        /// \param    filter Interpolation mode of all pages
+        /// \returns  false if the file is missing or corrupt.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool open(const char *path,
+                  InterpolationMode filter = InterpolationMode::NearestNeighbor);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     close
+        /// \brief  Destroys all pages and unmaps the file.
+        /// \note   All regions handed out become invalid.
+        ///
+        ///////////////////////////////////////////////////////////
+        void close();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       find -> const
+        /// \brief    Looks up an image by its name.
+        /// \param    name Name of the image, e.g. "ui/button"
+        /// \returns  the region of the image or an invalid one.
+        ///
+        ///////////////////////////////////////////////////////////
+        TextureRegion find(const char *name) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       imageCount -> const
+        /// \brief    Retrieves the amount of images in the file.
+        /// \returns  the amount of entries of the file.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 imageCount() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       pageCount -> const
+        /// \brief    Retrieves the amount of pages in the file.
+        /// \returns  the amount of textures of this atlas.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 pageCount() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       page -> const
+        /// \brief    Retrieves the texture of the given page.
+        /// \param    index Index of the page
+        /// \returns  the RGBA texture of the page.
+        ///
+        ///////////////////////////////////////////////////////////
+        const Texture &page(QUInt32 index) const;
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       validate -> const
+        /// \brief    Checks all tables against the size of the file.
+        /// \returns  false if any table exceeds the file.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool validate() const;
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        const QUInt8 *m_Data;                   ///< Mapped file
+        QUInt32 m_Size;                         ///< Size of the file
+        const AtlasFileHeader *m_Header;        ///< Header of the file
+        const AtlasFileEntry *m_Entries;        ///< Sorted entry table
+        const char *m_Names;                    ///< Name pool
+        std::vector<Texture> m_Pages;           ///< Page textures
+
+    };
+}
+
+
+#endif  // __Q2D_PACKEDATLAS_HPP__
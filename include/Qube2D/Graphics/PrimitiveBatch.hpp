@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_PRIMITIVEBATCH_HPP__
+#define __Q2D_PRIMITIVEBATCH_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Uncopyable.hpp>
+#include <Qube2D/System/Structs/Vertices.hpp>
+#include <Qube2D/Graphics/System/Base/IPrimitive.hpp>
+#include <Qube2D/Graphics/System/OpenGL/VertexArray.hpp>
+#include <Qube2D/Graphics/System/OpenGL/ShaderProgram.hpp>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    PrimitiveBatch.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   PrimitiveBatch : Uncopyable
+    /// \brief   Merges many shape draws into few draw calls.
+    ///
+    /// Shapes passed to PrimitiveBatch::draw are transformed on
+    /// the CPU, their opacity is baked into the vertex colors
+    /// and their topology is converted to indexed lists: fans
+    /// and strips become triangle lists, loops and strips
+    /// become line lists. Consecutive shapes of the same list
+    /// topology (triangles, lines or points) and shader program
+    /// are drawn with one indexed draw call.
+    ///
+    /// Shapes are drawn in the order they were passed in; a
+    /// change of the topology or the shader program flushes
+    /// the batch. Interleaving filled and outlined shapes thus
+    /// costs one draw call per change.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API PrimitiveBatch : Uncopyable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of Qube2D::PrimitiveBatch.
+        ///
+        ///////////////////////////////////////////////////////////
+        PrimitiveBatch();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     create
+        /// \brief  Creates all OpenGL-related objects.
+        /// \param  capacity Vertices per draw call before flushing
+        ///
+        ///////////////////////////////////////////////////////////
+        void create(QUInt32 capacity = 65536);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     destroy
+        /// \brief  Destroys all OpenGL-related objects.
+        ///
+        ///////////////////////////////////////////////////////////
+        void destroy();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     begin
+        /// \brief  Starts a new batch and resets the statistics.
+        ///
+        ///////////////////////////////////////////////////////////
+        void begin();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     draw
+        /// \brief  Appends the given shape to the batch.
+        /// \param  primitive Line, polygon, circle, ... to draw
+        /// \note   Shapes using DrawMode::Patches are ignored.
+        ///
+        ///////////////////////////////////////////////////////////
+        void draw(const IPrimitive &primitive);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     flush
+        /// \brief  Renders all pending shapes.
+        ///
+        ///////////////////////////////////////////////////////////
+        void flush();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     end
+        /// \brief  Renders all pending shapes and ends the batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        void end();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       drawCalls -> const
+        /// \brief    Retrieves the draw calls issued since begin.
+        /// \returns  the amount of draw calls of the current batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 drawCalls() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       primitiveCount -> const
+        /// \brief    Retrieves the shapes drawn since begin.
+        /// \returns  the amount of shapes of the current batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 primitiveCount() const;
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     addIndices
+        /// \brief  Appends the list indices of the given topology.
+        /// \param  mode Topology of the shape
+        /// \param  base Index of the shape's first vertex
+        /// \param  count Amount of vertices of the shape
+        ///
+        ///////////////////////////////////////////////////////////
+        void addIndices(DrawMode mode, QUInt32 base, QUInt32 count);
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        VertexArray m_VertexArray;                  ///< Batch vertex array
+        std::vector<PrimitiveVertex> m_Vertices;    ///< Vertices of the run
+        std::vector<QUInt32> m_Indices;             ///< Indices of the run
+        QUInt32 m_Capacity;                         ///< Vertices per run
+        QUInt32 m_Topology;                         ///< Topology of the run
+        ShaderProgram *m_Program;                   ///< Program of the run
+        QUInt32 m_DrawCalls;                        ///< Draw calls since begin
+        QUInt32 m_PrimitiveCount;                   ///< Shapes since begin
+    };
+}
+
+
+#endif  // __Q2D_PRIMITIVEBATCH_HPP__
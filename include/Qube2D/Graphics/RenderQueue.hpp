@@ -0,0 +1,287 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_RENDERQUEUE_HPP__
+#define __Q2D_RENDERQUEUE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Uncopyable.hpp>
+#include <Qube2D/Graphics/SpriteBatch.hpp>
+#include <Qube2D/Graphics/PrimitiveBatch.hpp>
+#include <Qube2D/Graphics/TextBatch.hpp>
+#include <Qube2D/Graphics/Text.hpp>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    RenderQueue.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \struct  RenderItem
+    /// \brief   Defines one object submitted to a render queue.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct RenderItem
+    {
+        QUInt64 key;        ///< Packed sort key
+        const void *object; ///< Sprite, primitive or text
+        QUInt32 kind;       ///< Type of the object
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    RenderQueue.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   RenderQueue : Uncopyable
+    /// \brief   Sorts objects by render state before drawing.
+    ///
+    /// Every submitted object is given a 64-bit key. From the
+    /// most to the least significant bits, it consists of:
+    ///
+    ///   - layer (8 bits)
+    ///   - band (16 bits)
+    ///   - kind (2), program (12), texture (20) and blend mode
+    ///     (4 bits)
+    ///
+    /// Nothing is depth tested, thus objects overlapping each
+    /// other must be drawn in submission order. An object is
+    /// put into the band after the highest band of the objects
+    /// submitted before it in the same layer that share one of
+    /// its cells, a coarse grid on the screen. Objects of one
+    /// band never overlap, thus reordering them by their state
+    /// leaves the image unchanged, translucent or not. Objects
+    /// spanning too many cells are drawn after all earlier and
+    /// before all later objects of their layer instead.
+    ///
+    /// RenderQueue::execute radix-sorts the keys and renders
+    /// the objects through a Qube2D::SpriteBatch, a
+    /// Qube2D::PrimitiveBatch and a Qube2D::TextBatch, which
+    /// merge consecutive objects sharing their state. Lower
+    /// layers are drawn first.
+    ///
+    /// Objects are referenced, not copied, and must stay alive
+    /// until the queue has been executed.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API RenderQueue : Uncopyable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of Qube2D::RenderQueue.
+        ///
+        ///////////////////////////////////////////////////////////
+        RenderQueue();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     create
+        /// \brief  Creates the batches used to execute the queue.
+        /// \param  capacity Maximum amount of sprites per draw call
+        /// \param  mode Submission mode of the sprite batch
+        ///
+        ///////////////////////////////////////////////////////////
+        void create(QUInt32 capacity = 4096,
+                    BatchMode mode = BatchMode::Vertices);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     destroy
+        /// \brief  Destroys the batches.
+        ///
+        ///////////////////////////////////////////////////////////
+        void destroy();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     setStateSorting
+        /// \brief  Lets objects of a layer that do not overlap be
+        ///         reordered by their render state.
+        /// \param  enabled Group objects by state?
+        /// \note   Enabled by default. If disabled, all objects of
+        ///         a layer are drawn in submission order, which
+        ///         skips finding the bands of the objects.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setStateSorting(QBool enabled);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     submit
+        /// \brief  Queues the given sprite.
+        /// \param  sprite Sprite, animation or background to draw
+        /// \param  layer Layer to draw in, 0 to 255
+        ///
+        ///////////////////////////////////////////////////////////
+        void submit(const ISprite &sprite, QUInt32 layer = 0);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     submit
+        /// \brief  Queues the given shape.
+        /// \param  primitive Line, polygon, circle, ... to draw
+        /// \param  layer Layer to draw in, 0 to 255
+        ///
+        ///////////////////////////////////////////////////////////
+        void submit(const IPrimitive &primitive, QUInt32 layer = 0);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     submit
+        /// \brief  Queues the given text.
+        /// \param  text Text to draw
+        /// \param  layer Layer to draw in, 0 to 255
+        ///
+        ///////////////////////////////////////////////////////////
+        void submit(Text &text, QUInt32 layer = 0);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     sort
+        /// \brief  Sorts the queued objects by their keys.
+        /// \note   Called by execute; the sort is stable.
+        ///
+        ///////////////////////////////////////////////////////////
+        void sort();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     execute
+        /// \brief  Sorts and renders all objects, then clears.
+        ///
+        ///////////////////////////////////////////////////////////
+        void execute();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     clear
+        /// \brief  Removes all objects without rendering them.
+        ///
+        ///////////////////////////////////////////////////////////
+        void clear();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       size -> const
+        /// \brief    Retrieves the amount of queued objects.
+        /// \returns  the objects submitted since the last execute.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 size() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       items -> const
+        /// \brief    Retrieves the queued objects.
+        /// \returns  the objects, sorted if sort was called.
+        ///
+        ///////////////////////////////////////////////////////////
+        const std::vector<RenderItem> &items() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       drawCalls -> const
+        /// \brief    Retrieves the draw calls of the last execute.
+        /// \returns  the amount of draw calls.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 drawCalls() const;
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     push
+        /// \brief  Builds the key of an object and queues it.
+        ///
+        ///////////////////////////////////////////////////////////
+        void push(const void *object,
+                  QUInt32 kind,
+                  QUInt32 layer,
+                  const RectF &bounds,
+                  QUInt32 program,
+                  QUInt32 texture,
+                  QUInt32 blend);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       bandOf
+        /// \brief    Finds the band of an object and marks its cells.
+        /// \param    layer Layer of the object
+        /// \param    bounds Bounds of the object on screen
+        /// \returns  the lowest band above all earlier objects of
+        ///           the layer sharing a cell with the object.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 bandOf(QUInt32 layer, const RectF &bounds);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       cell
+        /// \brief    Looks up a cell, inserting it if not present.
+        /// \param    key Packed layer and cell coordinates
+        /// \returns  the band after the highest one in the cell.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 &cell(QUInt64 key);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     finishRun
+        /// \brief  Ends the batch of the given kind, if any.
+        ///
+        ///////////////////////////////////////////////////////////
+        void finishRun(QUInt32 kind);
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        SpriteBatch m_SpriteBatch;          ///< Renders sprites
+        PrimitiveBatch m_PrimitiveBatch;    ///< Renders shapes
+        TextBatch m_TextBatch;              ///< Renders texts
+        std::vector<RenderItem> m_Items;    ///< Queued objects
+        std::vector<RenderItem> m_Swap;     ///< Radix sort buffer
+        std::vector<QUInt64> m_CellKeys;    ///< Hashed cells; zero if empty
+        std::vector<QUInt32> m_CellBands;   ///< Band after each cell's top
+        QUInt32 m_CellCount;                ///< Occupied cells
+        QUInt32 m_Floors[256];              ///< Lowest band left per layer
+        QUInt32 m_Tops[256];                ///< Band after the top per layer
+        QUInt32 m_Sequence;                 ///< Submission counter
+        QUInt32 m_DrawCalls;                ///< Draw calls of execute
+        QBool m_StateSorting;               ///< Reorder by state?
+    };
+}
+
+
+#endif  // __Q2D_RENDERQUEUE_HPP__
@@ -0,0 +1,263 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_SPATIALINDEX_HPP__
+#define __Q2D_SPATIALINDEX_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Uncopyable.hpp>
+#include <Qube2D/System/Structs/Rect.hpp>
+#include <Qube2D/Graphics/System/Base/ISpatial.hpp>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    SpatialIndex.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \struct  SpatialEntry
+    /// \brief   Defines one object tracked by a spatial index.
+    ///
+    /// The cell range is inclusive. An empty range (x0 > x1)
+    /// means that the entry is not linked to any cell.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct SpatialEntry
+    {
+        ISpatial *object;   ///< Tracked object or NULL if free
+        RectF bounds;       ///< Bounds at the last update
+        QInt32 x0;          ///< First covered cell column
+        QInt32 y0;          ///< First covered cell row
+        QInt32 x1;          ///< Last covered cell column
+        QInt32 y1;          ///< Last covered cell row
+        QUInt32 stamp;      ///< Last query that visited it
+        QBool isLarge;      ///< Kept in the oversize list?
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    SpatialIndex.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   SpatialIndex : Uncopyable
+    /// \brief   Finds objects by area or point in sub-linear time.
+    ///
+    /// Buckets the bounds of Qube2D::ISpatial objects (sprites,
+    /// primitives and texts) into a hashed uniform grid. The
+    /// objects report their own changes, so only the moved,
+    /// rotated or scaled objects are re-bucketed before the
+    /// next query; most of them stay in their cells. Objects
+    /// spanning more than SPATIAL_MAX_CELLS cells are kept in
+    /// a separate list that every query tests.
+    ///
+    /// The cell size should be about the size of a typical
+    /// object. Results are unordered; objects are referenced,
+    /// not copied.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API SpatialIndex : Uncopyable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of SpatialIndex.
+        /// \param  cellSize Edge length of a grid cell, in pixels
+        ///
+        ///////////////////////////////////////////////////////////
+        SpatialIndex(QFloat cellSize = 128.f);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Destructor
+        /// \brief  Removes all objects from the index.
+        ///
+        ///////////////////////////////////////////////////////////
+        ~SpatialIndex();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     insert
+        /// \brief  Starts tracking the given object.
+        /// \param  object Object to track; leaves its previous index
+        ///
+        ///////////////////////////////////////////////////////////
+        void insert(ISpatial *object);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     remove
+        /// \brief  Stops tracking the given object.
+        /// \param  object Object tracked by this index
+        ///
+        ///////////////////////////////////////////////////////////
+        void remove(ISpatial *object);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     clear
+        /// \brief  Stops tracking all objects.
+        ///
+        ///////////////////////////////////////////////////////////
+        void clear();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     update
+        /// \brief  Re-buckets the objects that changed.
+        /// \note   Called by all queries; only needs to be called
+        ///         manually to control when the work is done.
+        ///
+        ///////////////////////////////////////////////////////////
+        void update();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     query
+        /// \brief  Finds all objects overlapping the given area.
+        /// \param  area Area to test, in window coordinates
+        /// \param  result Receives the objects; is not cleared
+        ///
+        ///////////////////////////////////////////////////////////
+        void query(const RectF &area, std::vector<ISpatial *> &result);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     query (overload #1)
+        /// \brief  Finds all objects containing the given point.
+        /// \param  x X-coordinate, e.g. of Mouse::cursorPos()
+        /// \param  y Y-coordinate, e.g. of Mouse::cursorPos()
+        /// \param  result Receives the objects; is not cleared
+        ///
+        ///////////////////////////////////////////////////////////
+        void query(QFloat x, QFloat y, std::vector<ISpatial *> &result);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     queryVisible
+        /// \brief  Finds all objects overlapping the window.
+        /// \param  result Receives the objects; is not cleared
+        ///
+        ///////////////////////////////////////////////////////////
+        void queryVisible(std::vector<ISpatial *> &result);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       size -> const
+        /// \brief    Retrieves the amount of tracked objects.
+        /// \returns  the amount of inserted and not removed objects.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 size() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       cellSize -> const
+        /// \brief    Retrieves the edge length of a grid cell.
+        /// \returns  the cell size passed to the constructor.
+        ///
+        ///////////////////////////////////////////////////////////
+        QFloat cellSize() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       cellCount -> const
+        /// \brief    Retrieves the amount of occupied grid cells.
+        /// \returns  the cells holding at least one object.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 cellCount() const;
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     enqueue
+        /// \brief  Remembers the entry for the next update.
+        /// \param  id Entry of the changed object
+        ///
+        ///////////////////////////////////////////////////////////
+        void enqueue(QUInt32 id);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     place
+        /// \brief  Moves the entry into the cells of its bounds.
+        /// \param  id Entry to move
+        /// \param  bounds New bounds of the entry
+        ///
+        ///////////////////////////////////////////////////////////
+        void place(QUInt32 id, const RectF &bounds);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     unlink
+        /// \brief  Removes the entry from all of its cells.
+        /// \param  id Entry to remove
+        ///
+        ///////////////////////////////////////////////////////////
+        void unlink(QUInt32 id);
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        std::unordered_map<QUInt64, std::vector<QUInt32> > m_Cells; ///< Entries per cell
+        std::vector<SpatialEntry> m_Entries;    ///< All entries
+        std::vector<QUInt32> m_Free;            ///< Unused entries
+        std::vector<QUInt32> m_Queued;          ///< Changed entries
+        std::vector<QUInt32> m_Large;           ///< Oversized entries
+        QFloat m_CellSize;                      ///< Cell edge length
+        QFloat m_InvCellSize;                   ///< Reciprocal cell size
+        QUInt32 m_Stamp;                        ///< Current query stamp
+        QUInt32 m_Count;                        ///< Tracked objects
+
+
+        ///////////////////////////////////////////////////////////
+        // Friend classes
+        //
+        ///////////////////////////////////////////////////////////
+        friend class ISpatial;
+
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define SPATIAL_MAX_CELLS   64
+}
+
+
+#endif  // __Q2D_SPATIALINDEX_HPP__
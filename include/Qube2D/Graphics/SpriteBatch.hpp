@@ -0,0 +1,294 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_SPRITEBATCH_HPP__
+#define __Q2D_SPRITEBATCH_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Uncopyable.hpp>
+#include <Qube2D/System/Structs/Vertices.hpp>
+#include <Qube2D/Graphics/System/Base/ISprite.hpp>
+#include <Qube2D/Graphics/System/OpenGL/VertexArray.hpp>
+#include <Qube2D/Graphics/System/OpenGL/VertexBuffer.hpp>
+#include <Qube2D/Graphics/System/OpenGL/ShaderProgram.hpp>
+#include <Qube2D/Graphics/System/QuadKernel.hpp>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    SpriteBatch.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   SpriteBatch : Uncopyable
+    /// \brief   Merges many sprite draws into few draw calls.
+    ///
+    /// Sprites passed to SpriteBatch::draw are gathered in a
+    /// Qube2D::QuadList and transformed by the SIMD kernel right
+    /// into the shared vertex buffer upon flushing. One
+    /// draw call is issued for each consecutive run of sprites
+    /// sharing the same texture, shader program and blend mode.
+    /// Sorting the sprites by texture before drawing them thus
+    /// results in the least amount of draw calls.
+    ///
+    /// In BatchMode::Instanced, only 60 bytes per sprite are
+    /// streamed and the vertex shader transforms a unit quad.
+    /// The blend colors of all four corners are kept.
+    /// Sprites with a custom shader program are still drawn
+    /// as transformed quads, since the program expects them.
+    ///
+    /// In BatchMode::MultiTexture, each vertex additionally
+    /// carries the slot of its texture. Up to 32 textures (or
+    /// GL_MAX_TEXTURE_IMAGE_UNITS, if less) are bound at once,
+    /// thus texture changes only split runs once the slots
+    /// are exhausted.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API SpriteBatch : Uncopyable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of Qube2D::SpriteBatch.
+        ///
+        ///////////////////////////////////////////////////////////
+        SpriteBatch();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     create
+        /// \brief  Creates all OpenGL-related objects.
+        /// \param  capacity Maximum amount of sprites per draw call
+        /// \param  mode Submits transformed quads or instances
+        /// \note   The capacity is limited to 16384 sprites, since
+        ///         the batch uses 16-bit indices.
+        ///
+        ///////////////////////////////////////////////////////////
+        void create(QUInt32 capacity = 4096,
+                    BatchMode mode = BatchMode::Vertices);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     destroy
+        /// \brief  Destroys all OpenGL-related objects.
+        ///
+        ///////////////////////////////////////////////////////////
+        void destroy();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     begin
+        /// \brief  Starts a new batch and resets the statistics.
+        ///
+        ///////////////////////////////////////////////////////////
+        void begin();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     draw
+        /// \brief  Appends the given sprite to the batch.
+        /// \param  sprite Sprite, animation or background to draw
+        /// \note   Flushes the batch beforehand if the texture,
+        ///         shader program or blend mode differs from the
+        ///         previous sprite or if the batch is full. In
+        ///         BatchMode::MultiTexture, a new texture only
+        ///         flushes if all texture slots are occupied.
+        ///
+        ///////////////////////////////////////////////////////////
+        void draw(const ISprite &sprite);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     flush
+        /// \brief  Renders all pending sprites in one draw call.
+        ///
+        ///////////////////////////////////////////////////////////
+        void flush();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     end
+        /// \brief  Renders all pending sprites and ends the batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        void end();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       drawCalls -> const
+        /// \brief    Retrieves the draw calls issued since begin.
+        /// \returns  the amount of draw calls of the current batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 drawCalls() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       spriteCount -> const
+        /// \brief    Retrieves the sprites drawn since begin.
+        /// \returns  the amount of sprites of the current batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 spriteCount() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       mode -> const
+        /// \brief    Retrieves the way sprites are submitted.
+        /// \returns  one of the Qube2D::BatchMode enum values.
+        ///
+        ///////////////////////////////////////////////////////////
+        BatchMode mode() const;
+
+
+    #ifdef __Q2D_LIBRARY__
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     initializeGL
+        /// \brief  Creates the instancing and multi-texture programs.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void initializeGL();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     destroyGL
+        /// \brief  Destroys the instancing and multi-texture programs.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void destroyGL();
+
+    #endif
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       isInstancing -> const
+        /// \brief    Determines whether the pending run is instanced.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool isInstancing() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       isMultiTexturing -> const
+        /// \brief    Determines whether the pending run uses slots.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool isMultiTexturing() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       acquireSlot
+        /// \brief    Retrieves the slot the given texture is bound to.
+        /// \param    texture OpenGL texture ID
+        /// \returns  the slot or -1 if all slots are occupied.
+        ///
+        ///////////////////////////////////////////////////////////
+        QInt32 acquireSlot(QUInt32 texture);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     addQuad
+        /// \brief  Appends the sprite's quad to the batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        void addQuad(const ISprite &sprite);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     addInstance
+        /// \brief  Appends the sprite's instance data to the batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        void addInstance(const ISprite &sprite);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     flushQuads
+        /// \brief  Renders all pending quads.
+        ///
+        ///////////////////////////////////////////////////////////
+        void flushQuads(const float *projection);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     flushInstances
+        /// \brief  Renders all pending instances.
+        ///
+        ///////////////////////////////////////////////////////////
+        void flushInstances(const float *projection);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     flushMultiTexture
+        /// \brief  Renders all pending quads and their texture slots.
+        ///
+        ///////////////////////////////////////////////////////////
+        void flushMultiTexture(const float *projection);
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        VertexArray m_VertexArray;              ///< Batch vertex array
+        VertexArray m_InstanceArray;            ///< Instance vertex array
+        VertexArray m_MultiArray;               ///< Multi-texture vertex array
+        VertexBuffer m_IndexBuffer;             ///< Static quad indices
+        VertexBuffer m_UnitQuad;                ///< Corners of instances
+        QuadList m_Quads;                       ///< Pending sprites
+        std::vector<SpriteInstance> m_Instances; ///< Sprite instances
+        std::vector<float> m_Slots;             ///< Texture slot per vertex
+        std::vector<QUInt32> m_SlotTextures;    ///< Textures of the slots
+        QUInt32 m_SlotCount;                    ///< Occupied texture slots
+        BatchMode m_Mode;                       ///< Submission mode
+        QUInt32 m_Capacity;                     ///< Max. sprites per draw
+        QUInt32 m_Count;                        ///< Pending sprites
+        QUInt32 m_Texture;                      ///< Texture of the run
+        ShaderProgram *m_Program;               ///< Program of the run
+        BlendMode m_BlendMode;                  ///< Blend mode of the run
+        QUInt32 m_DrawCalls;                    ///< Draw calls since begin
+        QUInt32 m_SpriteCount;                  ///< Sprites since begin
+
+        ///////////////////////////////////////////////////////////
+        // Static class members
+        //
+        ///////////////////////////////////////////////////////////
+        static ShaderProgram m_InstanceProgram; ///< Instancing program
+        static Shader m_VertexShader;           ///< Instancing vert. shader
+        static Shader m_FragShader;             ///< Texture frag. shader
+        static ShaderProgram m_MultiProgram;    ///< Multi-texture program
+        static Shader m_MultiVertexShader;      ///< Multi-texture vert. shader
+        static Shader m_MultiFragShader;        ///< Multi-texture frag. shader
+        static QUInt32 m_MaxSlots;              ///< Usable texture units
+    };
+}
+
+
+#endif  // __Q2D_SPRITEBATCH_HPP__
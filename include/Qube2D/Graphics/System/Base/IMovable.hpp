@@ -40,6 +40,7 @@
 ///////////////////////////////////////////////////////////
 #include <Qube2D/Config.hpp>
 #include <Qube2D/Graphics/System/Base/BaseEnums.hpp>
+#include <Qube2D/System/Structs/Transform.hpp>
 
 
 namespace Qube2D
@@ -182,6 +183,13 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         void updateMovement(double deltaTime);
 
+        ///////////////////////////////////////////////////////////
+        /// \fn     boundsChanged -> virtual
+        /// \brief  Called whenever the position changes.
+        ///
+        ///////////////////////////////////////////////////////////
+        virtual void boundsChanged();
+
 
     private:
 
@@ -209,6 +217,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     extern QFloat m_WinW;              ///< Window width
     extern QFloat m_WinH;              ///< Window height
+    extern Transform m_Projection;     ///< Window to clip space
 
 
     #define IMOVABLE_UPDATE_INTERVAL 0.010
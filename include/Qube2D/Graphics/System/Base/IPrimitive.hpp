@@ -40,11 +40,13 @@
 ///////////////////////////////////////////////////////////
 #include <Qube2D/Config.hpp>
 #include <Qube2D/System/Structs/Color.hpp>
+#include <Qube2D/System/Structs/Rect.hpp>
 #include <Qube2D/System/Structs/Vertices.hpp>
 #include <Qube2D/Graphics/System/GraphicsEnums.hpp>
 #include <Qube2D/Graphics/System/Base/IFadable.hpp>
 #include <Qube2D/Graphics/System/Base/IMovable.hpp>
 #include <Qube2D/Graphics/System/Base/ITransformable.hpp>
+#include <Qube2D/Graphics/System/Base/ISpatial.hpp>
 #include <Qube2D/Graphics/System/OpenGL/VertexArray.hpp>
 #include <Qube2D/Graphics/System/OpenGL/VertexBuffer.hpp>
 #include <Qube2D/Graphics/System/OpenGL/ShaderProgram.hpp>
@@ -62,7 +64,8 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     class Q2D_API IPrimitive : public IMovable,
                                public IFadable,
-                               public ITransformable
+                               public ITransformable,
+                               public ISpatial
     {
 
     public:
@@ -120,6 +123,39 @@ namespace Qube2D
         void render();
 
 
+        ///////////////////////////////////////////////////////////
+        /// \fn       vertices
+        /// \brief    Retrieves the untransformed vertex data.
+        /// \returns  the vertices, relative to the object.
+        ///
+        ///////////////////////////////////////////////////////////
+        const PolygonVertices &vertices() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       drawMode
+        /// \brief    Retrieves the topology of the vertices.
+        /// \returns  one of the Qube2D::DrawMode enum values.
+        ///
+        ///////////////////////////////////////////////////////////
+        DrawMode drawMode() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       shaderProgram
+        /// \brief    Retrieves the shader program used to render.
+        /// \returns  the custom or the default shader program.
+        ///
+        ///////////////////////////////////////////////////////////
+        ShaderProgram *shaderProgram() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       bounds
+        /// \brief    Retrieves the axis-aligned bounds on screen.
+        /// \returns  the transformed vertex hull, in window coordinates.
+        ///
+        ///////////////////////////////////////////////////////////
+        RectF bounds() const;
+
+
     #ifdef __Q2D_LIBRARY__
 
         ///////////////////////////////////////////////////////////
@@ -141,6 +177,13 @@ namespace Qube2D
 
     protected:
 
+        ///////////////////////////////////////////////////////////
+        /// \fn     boundsChanged
+        /// \brief  Queues the object for a spatial index update.
+        ///
+        ///////////////////////////////////////////////////////////
+        void boundsChanged();
+
 
         ///////////////////////////////////////////////////////////
         /// \fn     setVertexCount
@@ -166,7 +209,6 @@ namespace Qube2D
         // Class members
         //
         ///////////////////////////////////////////////////////////
-        VertexBuffer m_VertexBuffer;    ///< Buffer for vertex data
         PolygonVertices m_Vertices;     ///< Vertex data
         ShaderProgram *m_CustomProgram; ///< Custom shader program
         QUInt32 m_DrawMode;             ///< OpenGL drawing mode
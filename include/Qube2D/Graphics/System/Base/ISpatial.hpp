@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_ISPATIAL_HPP__
+#define __Q2D_ISPATIAL_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Structs/Rect.hpp>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Forward declarations
+    //
+    ///////////////////////////////////////////////////////////
+    class SpatialIndex;
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    ISpatial.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   ISpatial
+    /// \brief   Allows tracking an object in a SpatialIndex.
+    ///
+    /// Derived classes call invalidateBounds whenever their
+    /// position, transform or vertices change. The index then
+    /// re-reads the bounds of only those objects before the
+    /// next query. Copies of an object are never tracked and
+    /// an object leaves its index when it is destructed.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API ISpatial
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of ISpatial.
+        ///
+        ///////////////////////////////////////////////////////////
+        ISpatial();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Copy constructor
+        /// \brief  Creates an untracked copy.
+        ///
+        ///////////////////////////////////////////////////////////
+        ISpatial(const ISpatial &other);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Destructor -> virtual
+        /// \brief  Removes the object from its index.
+        ///
+        ///////////////////////////////////////////////////////////
+        virtual ~ISpatial();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Assignment operator
+        /// \brief  Keeps the index membership of this object.
+        ///
+        ///////////////////////////////////////////////////////////
+        ISpatial &operator =(const ISpatial &other);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       bounds -> const, pure virtual
+        /// \brief    Retrieves the axis-aligned bounds on screen.
+        /// \returns  the bounds, in window coordinates.
+        ///
+        ///////////////////////////////////////////////////////////
+        virtual RectF bounds() const = 0;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       spatialIndex -> const
+        /// \brief    Retrieves the index tracking this object.
+        /// \returns  the index or NULL if not tracked.
+        ///
+        ///////////////////////////////////////////////////////////
+        SpatialIndex *spatialIndex() const;
+
+
+    protected:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     invalidateBounds
+        /// \brief  Queues the object for a bounds update.
+        ///
+        ///////////////////////////////////////////////////////////
+        void invalidateBounds();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     leaveIndex
+        /// \brief  Removes the object from its index, if any.
+        ///
+        ///////////////////////////////////////////////////////////
+        void leaveIndex();
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        SpatialIndex *m_SpatialIndex;   ///< Tracking index
+        QUInt32 m_SpatialId;            ///< Entry within the index
+        QBool m_IsQueued;               ///< Awaits a bounds update?
+
+
+        ///////////////////////////////////////////////////////////
+        // Friend classes
+        //
+        ///////////////////////////////////////////////////////////
+        friend class SpatialIndex;
+
+    };
+}
+
+
+#endif  // __Q2D_ISPATIAL_HPP__
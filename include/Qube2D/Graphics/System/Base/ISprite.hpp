@@ -45,10 +45,12 @@
 #include <Qube2D/Graphics/System/Base/IFadable.hpp>
 #include <Qube2D/Graphics/System/Base/IMovable.hpp>
 #include <Qube2D/Graphics/System/Base/ITransformable.hpp>
+#include <Qube2D/Graphics/System/Base/ISpatial.hpp>
 #include <Qube2D/Graphics/System/OpenGL/Texture.hpp>
 #include <Qube2D/Graphics/System/OpenGL/VertexArray.hpp>
 #include <Qube2D/Graphics/System/OpenGL/VertexBuffer.hpp>
 #include <Qube2D/Graphics/System/OpenGL/ShaderProgram.hpp>
+#include <Qube2D/Graphics/System/Structs/TextureRegion.hpp>
 
 
 namespace Qube2D
@@ -63,7 +65,8 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     class Q2D_API ISprite : public IMovable,
                             public IFadable,
-                            public ITransformable
+                            public ITransformable,
+                            public ISpatial
     {
 
     public:
@@ -110,11 +113,24 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         virtual bool load(const Texture &texture);
 
+        ///////////////////////////////////////////////////////////
+        /// \fn     load (overload #2)
+        /// \brief  Displays an image packed by Qube2D::TextureAtlas.
+        /// \param  region Region of the image within its page
+        /// \note   The page is shared and not destroyed along with
+        ///         this sprite. Backgrounds and animations need a
+        ///         texture of their own, since they tile the image.
+        ///
+        ///////////////////////////////////////////////////////////
+        virtual bool load(const TextureRegion &region);
+
 
         ///////////////////////////////////////////////////////////
         /// \fn     setSourceRectangle
         /// \brief  Specifies the region of the image to be drawn.
         /// \param  rect Region to draw
+        /// \note   The rectangle is relative to the image, even if
+        ///         the image resides in an atlas page.
         ///
         ///////////////////////////////////////////////////////////
         void setSourceRectangle(const RectF &rect);
@@ -223,22 +239,88 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         const Texture &texture() const;
 
+        ///////////////////////////////////////////////////////////
+        /// \fn       vertices
+        /// \brief    Retrieves the untransformed vertex data.
+        /// \returns  the four vertices, relative to the object.
+        ///
+        ///////////////////////////////////////////////////////////
+        const TextureVertices &vertices() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       blendMode
+        /// \brief    Retrieves the fragment shader blend mode.
+        /// \returns  one of the Qube2D::BlendMode enum values.
+        ///
+        ///////////////////////////////////////////////////////////
+        BlendMode blendMode() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       shaderProgram
+        /// \brief    Retrieves the shader program used to render.
+        /// \returns  the custom or the default shader program.
+        ///
+        ///////////////////////////////////////////////////////////
+        ShaderProgram *shaderProgram() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       defaultShaderProgram -> static
+        /// \brief    Retrieves the built-in texture shader program.
+        /// \returns  the program used if no custom one is set.
+        ///
+        ///////////////////////////////////////////////////////////
+        static ShaderProgram *defaultShaderProgram();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       isVisible
+        /// \brief    Determines whether anything is to be drawn.
+        /// \returns  false if rendering would draw nothing.
+        ///
+        ///////////////////////////////////////////////////////////
+        virtual QBool isVisible() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       bounds
+        /// \brief    Retrieves the axis-aligned bounds on screen.
+        /// \returns  the transformed quad, in window coordinates.
+        ///
+        ///////////////////////////////////////////////////////////
+        RectF bounds() const;
+
 
     protected:
 
+        ///////////////////////////////////////////////////////////
+        /// \fn     boundsChanged
+        /// \brief  Queues the object for a spatial index update.
+        ///
+        ///////////////////////////////////////////////////////////
+        void boundsChanged();
+
+
         ///////////////////////////////////////////////////////////
         // Class members
         //
         ///////////////////////////////////////////////////////////
-        VertexBuffer m_VertexBuffer;    ///< Buffer for vertex data
         TextureVertices m_Vertices;     ///< Vertex data
         Texture m_Texture;              ///< Underlying texture
         BlendMode m_BlendMode;          ///< Fragment shader mode
         ShaderProgram *m_CustomProgram; ///< Custom shader program
+        RectF m_Region;                 ///< Image area within texture
+        QBool m_IsRegion;               ///< Texture is an atlas page
 
 
     private:
 
+        ///////////////////////////////////////////////////////////
+        /// \fn     releaseTexture
+        /// \brief  Destroys the owned texture or lets go of the page.
+        /// \note   Unlike destroy, stays in the spatial index.
+        ///
+        ///////////////////////////////////////////////////////////
+        void releaseTexture();
+
+
         ///////////////////////////////////////////////////////////
         // Static class members
         //
@@ -40,6 +40,7 @@
 ///////////////////////////////////////////////////////////
 #include <Qube2D/Config.hpp>
 #include <Qube2D/Graphics/System/Base/BaseEnums.hpp>
+#include <Qube2D/System/Structs/Transform.hpp>
 
 
 namespace Qube2D
@@ -81,6 +82,32 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         QFloat scale() const;
 
+        ///////////////////////////////////////////////////////////
+        /// \fn       originX
+        /// \brief    Retrieves the X-position of the origin.
+        /// \returns  the origin's X-position, relative to the object.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline QFloat originX() const { return m_OriginX; }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       originY
+        /// \brief    Retrieves the Y-position of the origin.
+        /// \returns  the origin's Y-position, relative to the object.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline QFloat originY() const { return m_OriginY; }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       transform -> const
+        /// \brief    Retrieves the origin, rotation and scaling.
+        /// \returns  the model transform, without the position.
+        /// \note     Only recomputed if origin, angle or scale
+        ///           changed since the last call.
+        ///
+        ///////////////////////////////////////////////////////////
+        const Transform &transform() const;
+
         ///////////////////////////////////////////////////////////
         /// \fn       isRotating
         /// \brief    Determines whether the object is rotating.
@@ -191,9 +218,12 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         void updateScaling(double deltaTime);
 
-
-        inline QFloat originX() { return m_OriginX; }
-        inline QFloat originY() { return m_OriginY; }
+        ///////////////////////////////////////////////////////////
+        /// \fn     boundsChanged -> virtual
+        /// \brief  Called whenever the origin, angle or scale changes.
+        ///
+        ///////////////////////////////////////////////////////////
+        virtual void boundsChanged();
 
 
     private:
@@ -216,6 +246,8 @@ namespace Qube2D
         QFloat m_Scale;             ///< Current scaling factor
         QFloat m_OriginX;           ///< Origin X-position
         QFloat m_OriginY;           ///< Origin Y-position
+        mutable Transform m_Transform; ///< Cached model transform
+        mutable QBool m_IsDirty;    ///< Transform outdated?
 
     };
 
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_CULLING_HPP__
+#define __Q2D_CULLING_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Structs/Rect.hpp>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    Culling.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \struct  CullStats
+    /// \brief   Holds the culling results of one frame.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct CullStats
+    {
+        QUInt32 tested;     ///< Objects tested against the view
+        QUInt32 culled;     ///< Objects rejected as invisible
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    Culling.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   Culling
+    /// \brief   Rejects objects that lie outside of the view.
+    ///
+    /// Sprites, texts, primitives and the batches test their
+    /// world-space bounds against the window area before they
+    /// submit any vertices. Objects that do not overlap it are
+    /// skipped entirely. The counters are reset by the main
+    /// loop at the end of each frame.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API Culling
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       isVisible
+        /// \brief    Tests the bounds against the window area.
+        /// \param    bounds Axis-aligned bounds in window space
+        /// \returns  true if the object must be rendered.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QBool isVisible(const RectF &bounds);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     setEnabled
+        /// \brief  Enables or disables culling; enabled by default.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void setEnabled(QBool enabled);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       isEnabled
+        /// \brief    Determines whether culling is enabled.
+        /// \returns  true if invisible objects are rejected.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QBool isEnabled();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       stats
+        /// \brief    Retrieves the results of the last frame.
+        /// \returns  the amount of tested and culled objects.
+        ///
+        ///////////////////////////////////////////////////////////
+        static const CullStats &stats();
+
+
+    #ifdef __Q2D_LIBRARY__
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     finishFrame
+        /// \brief  Publishes the counters and resets them.
+        /// \note   Must be called after all draws of a frame.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void finishFrame();
+
+    #endif
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Static class members
+        //
+        ///////////////////////////////////////////////////////////
+        static CullStats m_Current;         ///< Counters of this frame
+        static CullStats m_Last;            ///< Counters of last frame
+        static QBool m_IsEnabled;           ///< Culling enabled?
+
+    };
+}
+
+
+#endif  // __Q2D_CULLING_HPP__
@@ -86,6 +86,30 @@ namespace Qube2D
         TriangleFan     = 0x0006,
         Patches         = 0x000E,
     };
+
+    ///////////////////////////////////////////////////////////
+    /// \enum   BatchMode
+    /// \brief  Defines how a sprite batch submits its sprites.
+    ///
+    ///////////////////////////////////////////////////////////
+    enum class BatchMode : unsigned int
+    {
+        Vertices     = 0,   ///< Transforms the quads on the CPU
+        Instanced    = 1,   ///< Transforms a unit quad per instance
+        MultiTexture = 2    ///< Binds several textures per draw call
+    };
+
+    ///////////////////////////////////////////////////////////
+    /// \enum   SimdLevel
+    /// \brief  Defines the instruction sets of the CPU kernels.
+    ///
+    ///////////////////////////////////////////////////////////
+    enum class SimdLevel : unsigned int
+    {
+        Scalar      = 0,    ///< Plain C++, available everywhere
+        SSE2        = 1,    ///< 4 quads per iteration
+        AVX2        = 2     ///< 8 quads per iteration
+    };
 }
 
 
@@ -46,12 +46,18 @@ namespace Qube2D
     /// Q2D_ANIM_ERROR_1
     /// Q2D_ANIM_ERROR_2
     /// Q2D_ANIM_ERROR_3
+    /// Q2D_ATLAS_ERROR_0
+    /// Q2D_ATLAS_ERROR_1
+    /// Q2D_ATLAS_ERROR_2
     ///
     ///////////////////////////////////////////////////////////
     #define Q2D_ANIM_ERROR_0 "This Qube2D animation file does not exist.\n    File: %0"
     #define Q2D_ANIM_ERROR_1 "The header of the animation file is corrupt.\n   File: %0"
     #define Q2D_ANIM_ERROR_2 "The frame table of the animation file is erroneous.\n    The width, height or the display duration shall not be zero.\n    File: %0"
     #define Q2D_ANIM_ERROR_3 "The animation file does not contain a valid PNG image.\n   File: %0"
+    #define Q2D_ATLAS_ERROR_0 "This image file does not exist.\n    File: %0"
+    #define Q2D_ATLAS_ERROR_1 "The image is empty or does not fit into an atlas page.\n    Load large images as separate textures instead."
+    #define Q2D_ATLAS_ERROR_2 "The atlas file is corrupt or of an unsupported version.\n    File: %0"
 }
 
 
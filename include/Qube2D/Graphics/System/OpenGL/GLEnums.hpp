@@ -51,8 +51,9 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     enum class BufferType : unsigned int
     {
-        Vertex  = 0x8892,   ///< Normal buffer for vertices
-        Index   = 0x8893    ///< Buffer for vertex indices
+        Vertex      = 0x8892,   ///< Normal buffer for vertices
+        Index       = 0x8893,   ///< Buffer for vertex indices
+        PixelUnpack = 0x88EC    ///< Source of texture uploads
     };
 
     ///////////////////////////////////////////////////////////
@@ -63,7 +64,8 @@ namespace Qube2D
     enum class BufferUsage : unsigned int
     {
         Static  = 0x88E4,   ///< Static draw
-        Dynamic = 0x88E8    ///< Dynamic draw
+        Dynamic = 0x88E8,   ///< Dynamic draw
+        Stream  = 0x88E0    ///< Stream draw (respecified each frame)
     };
 
     ///////////////////////////////////////////////////////////
@@ -45,12 +45,14 @@ namespace Qube2D
     /// Q2D_SHADER_ERROR_0
     /// Q2D_TEXTURE_ERROR_0
     /// Q2D_TEXTURE_ERROR_1
+    /// Q2D_STREAM_ERROR_0
     ///
     ///////////////////////////////////////////////////////////
 
     #define Q2D_SHADER_ERROR_0  "The given path is invalid. No such asset file exists.\n    Path: %0"
     #define Q2D_TEXTURE_ERROR_0 "The given path is invalid. No such asset file exists.\n    Path: %0"
     #define Q2D_TEXTURE_ERROR_1 "The given PNG image is invalid."
+    #define Q2D_STREAM_ERROR_0  "The stream buffer could not be mapped."
 
 }
 
@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_GLSTATE_HPP__
+#define __Q2D_GLSTATE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    GLState.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   GLState
+    /// \brief   Mirrors the OpenGL bindings to skip redundant calls.
+    ///
+    /// All OpenGL wrapper classes bind their objects through
+    /// this class. A call is only forwarded to OpenGL if the
+    /// requested object is not bound already. If OpenGL state
+    /// is modified behind the back of Qube2D, GLState::invalidate
+    /// must be called afterwards.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API GLState
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     bindVertexArray
+        /// \brief  Binds the given vertex array object.
+        /// \param  id ID of the VAO or zero
+        ///
+        ///////////////////////////////////////////////////////////
+        static void bindVertexArray(QUInt32 id);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     bindBuffer
+        /// \brief  Binds the given buffer object to the target.
+        /// \param  target GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER
+        /// \param  id ID of the buffer or zero
+        /// \note   The element buffer is part of the bound VAO and
+        ///         therefore forgotten when another VAO is bound.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void bindBuffer(QUInt32 target, QUInt32 id);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     useProgram
+        /// \brief  Makes the given shader program current.
+        /// \param  id ID of the shader program or zero
+        ///
+        ///////////////////////////////////////////////////////////
+        static void useProgram(QUInt32 id);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     activeTexture
+        /// \brief  Selects the active texture unit.
+        /// \param  unit Zero-based index of the texture unit
+        ///
+        ///////////////////////////////////////////////////////////
+        static void activeTexture(QUInt32 unit);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     bindTexture
+        /// \brief  Binds the 2D texture to the active texture unit.
+        /// \param  id ID of the texture or zero
+        ///
+        ///////////////////////////////////////////////////////////
+        static void bindTexture(QUInt32 id);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     enableAttrib
+        /// \brief  Enables an attribute of the bound vertex array.
+        /// \param  mask Enabled attributes of the bound VAO
+        /// \param  location Location index of the attribute
+        ///
+        ///////////////////////////////////////////////////////////
+        static void enableAttrib(QUInt32 &mask, QUInt32 location);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     disableAttrib
+        /// \brief  Disables an attribute of the bound vertex array.
+        /// \param  mask Enabled attributes of the bound VAO
+        /// \param  location Location index of the attribute
+        ///
+        ///////////////////////////////////////////////////////////
+        static void disableAttrib(QUInt32 &mask, QUInt32 location);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     forgetVertexArray
+        /// \brief  Must be called before the VAO is deleted.
+        /// \param  id ID of the VAO to delete
+        ///
+        ///////////////////////////////////////////////////////////
+        static void forgetVertexArray(QUInt32 id);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     forgetBuffer
+        /// \brief  Must be called before the buffer is deleted.
+        /// \param  id ID of the buffer to delete
+        ///
+        ///////////////////////////////////////////////////////////
+        static void forgetBuffer(QUInt32 id);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     forgetProgram
+        /// \brief  Must be called before the program is deleted.
+        /// \param  id ID of the program to delete
+        ///
+        ///////////////////////////////////////////////////////////
+        static void forgetProgram(QUInt32 id);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     forgetTexture
+        /// \brief  Must be called before the texture is deleted.
+        /// \param  id ID of the texture to delete
+        ///
+        ///////////////////////////////////////////////////////////
+        static void forgetTexture(QUInt32 id);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     invalidate
+        /// \brief  Forgets all bindings; the next bind is issued.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void invalidate();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       issuedCalls
+        /// \brief    Retrieves the state changes sent to OpenGL.
+        /// \returns  the amount of issued calls since the last reset.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QUInt64 issuedCalls();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       skippedCalls
+        /// \brief    Retrieves the redundant state changes.
+        /// \returns  the amount of skipped calls since the last reset.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QUInt64 skippedCalls();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     resetCounters
+        /// \brief  Resets the issued and skipped call counters.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void resetCounters();
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Static class members
+        //
+        ///////////////////////////////////////////////////////////
+        static QUInt32 m_VertexArray;       ///< Bound VAO
+        static QUInt32 m_ArrayBuffer;       ///< Bound vertex buffer
+        static QUInt32 m_ElementBuffer;     ///< Index buffer of the VAO
+        static QUInt32 m_Program;           ///< Current shader program
+        static QUInt32 m_ActiveUnit;        ///< Active texture unit
+        static QUInt32 m_Textures[32];      ///< 2D texture of each unit
+        static QUInt64 m_Issued;            ///< Calls sent to OpenGL
+        static QUInt64 m_Skipped;           ///< Calls skipped
+
+    };
+}
+
+
+#endif  // __Q2D_GLSTATE_HPP__
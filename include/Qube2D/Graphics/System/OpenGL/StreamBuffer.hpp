@@ -0,0 +1,223 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_STREAMBUFFER_HPP__
+#define __Q2D_STREAMBUFFER_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Uncopyable.hpp>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    StreamBuffer.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   StreamBuffer : Uncopyable
+    /// \brief   Ring buffer for vertex data respecified per frame.
+    ///
+    /// The buffer is split into three regions which are filled
+    /// one after another. Writes are mapped unsynchronized, so
+    /// the driver never has to reallocate the storage or wait
+    /// for the GPU. Instead, a fence is placed after the last
+    /// draw of each region and waited for before the region is
+    /// written again, which normally has passed long ago.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API StreamBuffer : Uncopyable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new Qube2D::StreamBuffer.
+        ///
+        ///////////////////////////////////////////////////////////
+        StreamBuffer();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     create
+        /// \brief  Allocates the OpenGL buffer with three regions.
+        /// \param  regionSize Size of one region, in bytes
+        ///
+        ///////////////////////////////////////////////////////////
+        void create(QUInt32 regionSize);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     destroy
+        /// \brief  Waits for the GPU and frees the OpenGL buffer.
+        ///
+        ///////////////////////////////////////////////////////////
+        void destroy();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       id -> const
+        /// \brief    Retrieves the ID of the OpenGL buffer.
+        /// \returns  the non-zero ID of the buffer.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 id() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     bind
+        /// \brief  Binds the buffer as the current vertex buffer.
+        ///
+        ///////////////////////////////////////////////////////////
+        void bind();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       map
+        /// \brief    Suballocates and maps a range for writing.
+        /// \param    size Amount of bytes to allocate
+        /// \param    offset Receives the byte offset of the range
+        /// \param    alignment Byte alignment of the offset
+        /// \returns  a pointer to the mapped range or NULL.
+        /// \note     The buffer stays bound until unmap is called.
+        /// \note     Data read by one draw must be mapped at once;
+        ///           another map may fence the region or reallocate
+        ///           the buffer before that draw is issued.
+        ///
+        ///////////////////////////////////////////////////////////
+        void *map(QUInt32 size, QUInt32 &offset, QUInt32 alignment = 16);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     unmap
+        /// \brief  Unmaps the range returned by the last map.
+        ///
+        ///////////////////////////////////////////////////////////
+        void unmap();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       write
+        /// \brief    Suballocates a range and copies data into it.
+        /// \param    data Data to copy
+        /// \param    size Size of the data, in bytes
+        /// \param    alignment Byte alignment of the offset
+        /// \returns  the byte offset of the data within the buffer.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 write(const void *data, QUInt32 size, QUInt32 alignment = 16);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     finishFrame
+        /// \brief  Fences the current region and moves on.
+        /// \note   Must be called after all draws of a frame.
+        ///
+        ///////////////////////////////////////////////////////////
+        void finishFrame();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       vertexStream -> static
+        /// \brief    Retrieves the stream shared by all renderers.
+        /// \returns  the global vertex stream buffer.
+        ///
+        ///////////////////////////////////////////////////////////
+        static StreamBuffer &vertexStream();
+
+
+    #ifdef __Q2D_LIBRARY__
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     initializeGL
+        /// \brief  Creates the shared vertex stream buffer.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void initializeGL();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     destroyGL
+        /// \brief  Destroys the shared vertex stream buffer.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void destroyGL();
+
+    #endif
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     advance
+        /// \brief  Fences the current region and waits for the next.
+        ///
+        ///////////////////////////////////////////////////////////
+        void advance();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     wait
+        /// \brief  Waits until the GPU has finished a region.
+        /// \param  region Index of the region to wait for
+        ///
+        ///////////////////////////////////////////////////////////
+        void wait(QUInt32 region);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     grow
+        /// \brief  Reallocates the buffer with bigger regions.
+        /// \param  size Minimum size of one region, in bytes
+        ///
+        ///////////////////////////////////////////////////////////
+        void grow(QUInt32 size);
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        QUInt32 m_ID;           ///< Buffer identifier within OpenGL
+        QUInt32 m_RegionSize;   ///< Size of one region, in bytes
+        QUInt32 m_Region;       ///< Region currently written to
+        QUInt32 m_Offset;       ///< Next free byte within the buffer
+        void *m_Fences[3];      ///< Sync objects of each region
+
+        ///////////////////////////////////////////////////////////
+        // Static class members
+        //
+        ///////////////////////////////////////////////////////////
+        static StreamBuffer m_VertexStream; ///< Shared vertex stream
+    };
+}
+
+
+#endif  // __Q2D_STREAMBUFFER_HPP__
@@ -198,6 +198,8 @@ namespace Qube2D
         /// \param   data Raw pixel data to store
         /// \param   rect Part of the texture to update
         /// \param   format Format of the given pixel data
+        /// \note    While a pixel unpack buffer is bound, 'data'
+        ///          is an offset into that buffer.
         ///
         ///////////////////////////////////////////////////////////
         void updatePixels(const QUInt8 *data,
@@ -136,7 +136,8 @@ namespace Qube2D
         // Class members
         //
         ///////////////////////////////////////////////////////////
-        QUInt32 m_ID;   ///< VAO identifier within OpenGL
+        QUInt32 m_ID;       ///< VAO identifier within OpenGL
+        QUInt32 m_Attribs;  ///< Bitmask of enabled attributes
 
     };
 }
@@ -0,0 +1,224 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_QUADKERNEL_HPP__
+#define __Q2D_QUADKERNEL_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Structs/Vertices.hpp>
+#include <Qube2D/System/Structs/Transform.hpp>
+#include <Qube2D/Graphics/System/GraphicsEnums.hpp>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    QuadKernel.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \struct  QuadArrays
+    /// \brief   Structure-of-arrays view of quads to transform.
+    ///
+    /// Each member points to one value per quad. The quad is
+    /// spanned by its local bounds and mapped by the affine
+    /// transform, which already contains the position. Colors
+    /// are packed as RGBA8 (red in the lowest byte) and given
+    /// per corner, clockwise from the top-left one.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct QuadArrays
+    {
+        const float *a;             ///< Transform, X-axis x
+        const float *b;             ///< Transform, X-axis y
+        const float *c;             ///< Transform, Y-axis x
+        const float *d;             ///< Transform, Y-axis y
+        const float *tx;            ///< Transform, X-translation
+        const float *ty;            ///< Transform, Y-translation
+        const float *left;          ///< Local left bound
+        const float *top;           ///< Local top bound
+        const float *right;         ///< Local right bound
+        const float *bottom;        ///< Local bottom bound
+        const float *u0;            ///< Texture left bound
+        const float *v0;            ///< Texture top bound
+        const float *u1;            ///< Texture right bound
+        const float *v1;            ///< Texture bottom bound
+        const float *opacity;       ///< Multiplied with alpha
+        const QUInt32 *colors[4];   ///< RGBA8 color per corner
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    QuadKernel.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   QuadList
+    /// \brief   Owns the arrays of a Qube2D::QuadArrays view.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API QuadList
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of Qube2D::QuadList.
+        ///
+        ///////////////////////////////////////////////////////////
+        QuadList();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     resize
+        /// \brief  Reallocates the arrays for the given capacity.
+        /// \param  capacity Maximum amount of quads
+        ///
+        ///////////////////////////////////////////////////////////
+        void resize(QUInt32 capacity);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     clear
+        /// \brief  Frees all arrays.
+        ///
+        ///////////////////////////////////////////////////////////
+        void clear();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     set
+        /// \brief  Stores the quad at the given index.
+        /// \param  index Index of the quad, less than the capacity
+        /// \param  transform Model transform including the position
+        /// \param  quad Untransformed, axis-aligned vertices
+        /// \param  opacity Opacity of the quad
+        ///
+        ///////////////////////////////////////////////////////////
+        void set(QUInt32 index,
+                 const Transform &transform,
+                 const TextureVertices &quad,
+                 QFloat opacity);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       arrays -> const
+        /// \brief    Retrieves the view passed to the kernel.
+        /// \returns  pointers to the arrays of this list.
+        ///
+        ///////////////////////////////////////////////////////////
+        const QuadArrays &arrays() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       capacity -> const
+        /// \brief    Retrieves the maximum amount of quads.
+        /// \returns  the capacity passed to resize.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 capacity() const;
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        std::vector<float> m_Floats;        ///< All float arrays
+        std::vector<QUInt32> m_Colors;      ///< All color arrays
+        QuadArrays m_Arrays;                ///< View of the arrays
+        QUInt32 m_Capacity;                 ///< Quads per array
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    QuadKernel.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   QuadKernel
+    /// \brief   Transforms quads into interleaved vertices.
+    ///
+    /// Writes four Qube2D::TextureVertex per quad and is meant
+    /// to target mapped buffer memory directly. On x86, SSE2
+    /// and AVX2 variants are compiled in regardless of the
+    /// compiler flags; the widest one supported by the CPU
+    /// is chosen at runtime. All variants yield equal results.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API QuadKernel
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     transform -> static
+        /// \brief  Transforms the quads using the widest ISA.
+        /// \param  quads Quads to transform
+        /// \param  count Amount of quads to transform
+        /// \param  out Receives 'count' transformed quads
+        ///
+        ///////////////////////////////////////////////////////////
+        static void transform(const QuadArrays &quads,
+                              QUInt32 count,
+                              TextureVertices *out);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     transform -> static
+        /// \brief  Transforms the quads using the given ISA.
+        /// \param  quads Quads to transform
+        /// \param  count Amount of quads to transform
+        /// \param  out Receives 'count' transformed quads
+        /// \param  level Instruction set; lowered if unsupported
+        ///
+        ///////////////////////////////////////////////////////////
+        static void transform(const QuadArrays &quads,
+                              QUInt32 count,
+                              TextureVertices *out,
+                              SimdLevel level);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       simdLevel -> static
+        /// \brief    Retrieves the widest ISA of this CPU.
+        /// \returns  the instruction set used by transform.
+        ///
+        ///////////////////////////////////////////////////////////
+        static SimdLevel simdLevel();
+    };
+}
+
+
+#endif  // __Q2D_QUADKERNEL_HPP__
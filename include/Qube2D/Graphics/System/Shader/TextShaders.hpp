@@ -81,9 +81,14 @@ namespace Qube2D
         "uniform sampler2D uni_texture;                                     \n"
         "uniform float uni_opacity;                                         \n"
         "uniform vec4 uni_color;                                            \n"
+        "uniform vec3 uni_edge;                                             \n"
         "                                                                   \n"
         "void main()                                                        \n"
         "{                                                                  \n"
+        "   // Derivatives are taken before any non-uniform branch          \n"
+        "   float texel = texture(uni_texture, frag_uv).r;                  \n"
+        "   float w = fwidth(texel) * 0.7 + uni_edge.z;                     \n"
+        "                                                                   \n"
         "   // Detects whether we are processing a line                     \n"
         "   if (frag_uv.x == 1.0 && frag_uv.y == 1.0)                       \n"
         "   {                                                               \n"
@@ -91,11 +96,99 @@ namespace Qube2D
         "       return;                                                     \n"
         "   }                                                               \n"
         "                                                                   \n"
-        "   float texel = texture(uni_texture, frag_uv).r;                  \n"
+        "   // Thresholds distance fields; x: outer edge, y: inner edge,    \n"
+        "   // z: additional softness. Bitmap glyphs have no edge.          \n"
+        "   if (uni_edge.x > 0.0)                                           \n"
+        "   {                                                               \n"
+        "       float d = texel;                                            \n"
+        "       texel = smoothstep(uni_edge.x - w, uni_edge.x + w, d);      \n"
+        "       if (uni_edge.y > 0.0)                                       \n"
+        "           texel -= smoothstep(uni_edge.y - w, uni_edge.y + w, d); \n"
+        "   }                                                               \n"
+        "                                                                   \n"
         "   vec4 blend = uni_color * vec4(1.0, 1.0, 1.0, uni_opacity);      \n"
         "   out_color = vec4(1.0, 1.0, 1.0, texel) * blend;                 \n"
         "}                                                                  \n"
     };
+
+    ///////////////////////////////////////////////////////////
+    /// \file    TextShader.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \var     Qube2D_TextBatchVertexShader
+    /// \brief   Passes the color of each vertex, including the
+    ///          opacity, instead of using uniforms.
+    ///
+    ///////////////////////////////////////////////////////////
+    const char Qube2D_TextBatchVertexShader[] =
+    {
+        "#version 330 core                          \n"
+        "                                           \n"
+        "layout(location = 0) in vec2 in_xy;        \n"
+        "layout(location = 1) in vec2 in_uv;        \n"
+        "layout(location = 2) in vec4 in_color;     \n"
+        "layout(location = 3) in vec3 in_edge;      \n"
+        "                                           \n"
+        "out vec2 frag_uv;                          \n"
+        "out vec4 frag_color;                       \n"
+        "flat out vec3 frag_edge;                   \n"
+        "uniform mat4 uni_mvp;                      \n"
+        "                                           \n"
+        "void main()                                \n"
+        "{                                          \n"
+        "   frag_uv = in_uv;                        \n"
+        "   frag_color = in_color;                  \n"
+        "   frag_edge = in_edge;                    \n"
+        "   gl_Position = uni_mvp * vec4(           \n"
+        "           in_xy,                          \n"
+        "           0.0,                            \n"
+        "           1.0);                           \n"
+        "}                                          \n"
+    };
+
+    ///////////////////////////////////////////////////////////
+    /// \file    TextShader.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \var     Qube2D_TextBatchFragShader
+    ///
+    ///////////////////////////////////////////////////////////
+    const char Qube2D_TextBatchFragShader[] =
+    {
+        "#version 330 core                                                  \n"
+        "                                                                   \n"
+        "in vec2 frag_uv;                                                   \n"
+        "in vec4 frag_color;                                                \n"
+        "flat in vec3 frag_edge;                                            \n"
+        "out vec4 out_color;                                                \n"
+        "                                                                   \n"
+        "uniform sampler2D uni_texture;                                     \n"
+        "                                                                   \n"
+        "void main()                                                        \n"
+        "{                                                                  \n"
+        "   // Derivatives are taken before any non-uniform branch          \n"
+        "   float texel = texture(uni_texture, frag_uv).r;                  \n"
+        "   float w = fwidth(texel) * 0.7 + frag_edge.z;                    \n"
+        "                                                                   \n"
+        "   // Detects whether we are processing a line                     \n"
+        "   if (frag_uv.x == 1.0 && frag_uv.y == 1.0)                       \n"
+        "   {                                                               \n"
+        "       out_color = frag_color;                                     \n"
+        "       return;                                                     \n"
+        "   }                                                               \n"
+        "                                                                   \n"
+        "   // Thresholds distance fields, as in Qube2D_TextFragShader      \n"
+        "   if (frag_edge.x > 0.0)                                          \n"
+        "   {                                                               \n"
+        "       float d = texel;                                            \n"
+        "       texel = smoothstep(frag_edge.x - w, frag_edge.x + w, d);    \n"
+        "       if (frag_edge.y > 0.0)                                      \n"
+        "           texel -= smoothstep(frag_edge.y - w, frag_edge.y + w, d); \n"
+        "   }                                                               \n"
+        "                                                                   \n"
+        "   out_color = vec4(1.0, 1.0, 1.0, texel) * frag_color;            \n"
+        "}                                                                  \n"
+    };
 }
 
 
@@ -94,6 +94,232 @@ namespace Qube2D
         "       frag_rgba * v_opac;                 \n"
         "}                                          \n"
     };
+
+    ///////////////////////////////////////////////////////////
+    /// \file    TextureShader.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \var     Qube2D_TextureInstanceVertexShader
+    /// \brief   Vertex shader for instanced sprites.
+    /// \note    Uses Qube2D_TextureFragShader as frag. shader.
+    ///
+    ///////////////////////////////////////////////////////////
+    const char Qube2D_TextureInstanceVertexShader[] =
+    {
+        "#version 330 core                          \n"
+        "                                           \n"
+        "layout(location = 0) in vec2 in_corner;    \n"
+        "layout(location = 1) in vec2 in_xy;        \n"
+        "layout(location = 2) in vec2 in_size;      \n"
+        "layout(location = 3) in vec2 in_origin;    \n"
+        "layout(location = 4) in float in_angle;    \n"
+        "layout(location = 5) in vec4 in_uv;        \n"
+        "layout(location = 6) in vec4 in_rgba0;     \n"
+        "layout(location = 7) in vec4 in_rgba1;     \n"
+        "layout(location = 8) in vec4 in_rgba2;     \n"
+        "layout(location = 9) in vec4 in_rgba3;     \n"
+        "                                           \n"
+        "out vec2 frag_uv;                          \n"
+        "out vec4 frag_rgba;                        \n"
+        "uniform mat4 uni_mvp;                      \n"
+        "                                           \n"
+        "void main()                                \n"
+        "{                                          \n"
+        "   float c = cos(in_angle);                \n"
+        "   float s = sin(in_angle);                \n"
+        "   vec2 d = in_corner*in_size - in_origin; \n"
+        "   vec2 p = in_xy + in_origin + vec2(      \n"
+        "           c * d.x - s * d.y,              \n"
+        "           s * d.x + c * d.y);             \n"
+        "                                           \n"
+        "   frag_uv = mix(in_uv.xy, in_uv.zw,       \n"
+        "                 in_corner);               \n"
+        "   frag_rgba = mix(                        \n"
+        "       mix(in_rgba0, in_rgba1, in_corner.x),\n"
+        "       mix(in_rgba3, in_rgba2, in_corner.x),\n"
+        "       in_corner.y);                       \n"
+        "   gl_Position = uni_mvp * vec4(           \n"
+        "           p,                              \n"
+        "           0.0,                            \n"
+        "           1.0);                           \n"
+        "}                                          \n"
+    };
+
+    ///////////////////////////////////////////////////////////
+    /// \file    TextureShader.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \var     Qube2D_TextureMultiVertexShader
+    /// \brief   Vertex shader for sprites of multiple textures.
+    /// \note    Forwards the texture slot of each vertex.
+    ///
+    ///////////////////////////////////////////////////////////
+    const char Qube2D_TextureMultiVertexShader[] =
+    {
+        "#version 330 core                          \n"
+        "                                           \n"
+        "layout(location = 0) in vec2 in_xy;        \n"
+        "layout(location = 1) in vec2 in_uv;        \n"
+        "layout(location = 2) in vec4 in_rgba;      \n"
+        "layout(location = 3) in float in_slot;     \n"
+        "                                           \n"
+        "out vec2 frag_uv;                          \n"
+        "out vec4 frag_rgba;                        \n"
+        "flat out int frag_slot;                    \n"
+        "uniform mat4 uni_mvp;                      \n"
+        "                                           \n"
+        "void main()                                \n"
+        "{                                          \n"
+        "   frag_uv = in_uv;                        \n"
+        "   frag_rgba = in_rgba;                    \n"
+        "   frag_slot = int(in_slot + 0.5);         \n"
+        "   gl_Position = uni_mvp * vec4(           \n"
+        "           in_xy,                          \n"
+        "           0.0,                            \n"
+        "           1.0);                           \n"
+        "}                                          \n"
+    };
+
+    ///////////////////////////////////////////////////////////
+    /// \file    TextureShader.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \var     Qube2D_TextureMultiFragShader
+    /// \brief   Fragment shader sampling one of up to 32 units.
+    /// \note    Lacks the version directive; prepend it and a
+    ///          definition of Q2D_SLOTS, the sampler count.
+    ///
+    /// Sampler arrays may only be indexed by constants in GLSL
+    /// 3.30, thus the slot is selected by a chain of branches.
+    /// The gradients are computed beforehand, since implicit
+    /// derivatives are undefined within such branches.
+    ///
+    ///////////////////////////////////////////////////////////
+    const char Qube2D_TextureMultiFragShader[] =
+    {
+        "in vec2 frag_uv;                           \n"
+        "in vec4 frag_rgba;                         \n"
+        "flat in int frag_slot;                     \n"
+        "                                           \n"
+        "out vec4 out_color;                        \n"
+        "uniform sampler2D uni_textures[Q2D_SLOTS]; \n"
+        "uniform float uni_opacity;                 \n"
+        "                                           \n"
+        "vec4 fetch(sampler2D tex, vec2 dx, vec2 dy)\n"
+        "{                                          \n"
+        "   return textureGrad(tex, frag_uv, dx, dy);\n"
+        "}                                          \n"
+        "                                           \n"
+        "#define SLOT(i) if (frag_slot == i) return fetch(uni_textures[i], dx, dy);\n"
+        "                                           \n"
+        "vec4 sampleSlot(vec2 dx, vec2 dy)          \n"
+        "{                                          \n"
+        "   SLOT(0)                                 \n"
+        "#if Q2D_SLOTS > 1                          \n"
+        "   SLOT(1)                                 \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 2                          \n"
+        "   SLOT(2)                                 \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 3                          \n"
+        "   SLOT(3)                                 \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 4                          \n"
+        "   SLOT(4)                                 \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 5                          \n"
+        "   SLOT(5)                                 \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 6                          \n"
+        "   SLOT(6)                                 \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 7                          \n"
+        "   SLOT(7)                                 \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 8                          \n"
+        "   SLOT(8)                                 \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 9                          \n"
+        "   SLOT(9)                                 \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 10                         \n"
+        "   SLOT(10)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 11                         \n"
+        "   SLOT(11)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 12                         \n"
+        "   SLOT(12)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 13                         \n"
+        "   SLOT(13)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 14                         \n"
+        "   SLOT(14)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 15                         \n"
+        "   SLOT(15)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 16                         \n"
+        "   SLOT(16)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 17                         \n"
+        "   SLOT(17)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 18                         \n"
+        "   SLOT(18)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 19                         \n"
+        "   SLOT(19)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 20                         \n"
+        "   SLOT(20)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 21                         \n"
+        "   SLOT(21)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 22                         \n"
+        "   SLOT(22)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 23                         \n"
+        "   SLOT(23)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 24                         \n"
+        "   SLOT(24)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 25                         \n"
+        "   SLOT(25)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 26                         \n"
+        "   SLOT(26)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 27                         \n"
+        "   SLOT(27)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 28                         \n"
+        "   SLOT(28)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 29                         \n"
+        "   SLOT(29)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 30                         \n"
+        "   SLOT(30)                                \n"
+        "#endif                                     \n"
+        "#if Q2D_SLOTS > 31                         \n"
+        "   SLOT(31)                                \n"
+        "#endif                                     \n"
+        "   return vec4(1.0);                       \n"
+        "}                                          \n"
+        "                                           \n"
+        "void main()                                \n"
+        "{                                          \n"
+        "   vec4 v_opac =                           \n"
+        "       vec4(1.0, 1.0, 1.0, uni_opacity);   \n"
+        "   out_color =                             \n"
+        "       sampleSlot(dFdx(frag_uv), dFdy(frag_uv)) *\n"
+        "       frag_rgba * v_opac;                 \n"
+        "}                                          \n"
+    };
 }
 
 
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_ATLASFILE_HPP__
+#define __Q2D_ATLASFILE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    AtlasFile.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \brief   Defines the layout of .qatlas files.
+    ///
+    /// A .qatlas file is written by the AtlasPacker tool and
+    /// consists of, in this order and little-endian:
+    ///
+    ///  - one AtlasFileHeader
+    ///  - AtlasFileHeader::pageCount times AtlasFilePage
+    ///  - AtlasFileHeader::entryCount times AtlasFileEntry,
+    ///    sorted by their hash and then by their name
+    ///  - the null-terminated names of all entries
+    ///  - the PNG image of each page
+    ///
+    /// All tables are 4-byte aligned, so they can be accessed
+    /// right within the memory-mapped file.
+    ///
+    ///////////////////////////////////////////////////////////
+    #define Q2D_ATLAS_FILE_MAGIC    0x4C544151u   // "QATL"
+    #define Q2D_ATLAS_FILE_VERSION  1u
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    AtlasFile.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \struct  AtlasFileHeader
+    /// \brief   Locates the tables of a .qatlas file.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct AtlasFileHeader
+    {
+        QUInt32 magic;          ///< Q2D_ATLAS_FILE_MAGIC
+        QUInt32 version;        ///< Q2D_ATLAS_FILE_VERSION
+        QUInt32 pageSize;       ///< Width and height of each page
+        QUInt32 pageCount;      ///< Amount of pages
+        QUInt32 entryCount;     ///< Amount of images
+        QUInt32 pageOffset;     ///< Offset of the page table
+        QUInt32 entryOffset;    ///< Offset of the entry table
+        QUInt32 nameOffset;     ///< Offset of the name pool
+    };
+
+    ///////////////////////////////////////////////////////////
+    /// \file    AtlasFile.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \struct  AtlasFilePage
+    /// \brief   Locates the PNG image of one page.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct AtlasFilePage
+    {
+        QUInt32 offset;         ///< Offset of the PNG image
+        QUInt32 size;           ///< Size of the PNG image
+    };
+
+    ///////////////////////////////////////////////////////////
+    /// \file    AtlasFile.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \struct  AtlasFileEntry
+    /// \brief   Locates one image within its page.
+    /// \note    The area excludes the extruded padding.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct AtlasFileEntry
+    {
+        QUInt32 hash;           ///< Hash of the name, see atlasHash
+        QUInt32 name;           ///< Offset of the name in the pool
+        QUInt16 page;           ///< Page containing the image
+        QUInt16 x;              ///< Left edge within the page
+        QUInt16 y;              ///< Top edge within the page
+        QUInt16 width;          ///< Width of the image
+        QUInt16 height;         ///< Height of the image
+        QUInt16 reserved;       ///< Keeps the entries aligned
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file     AtlasFile.hpp
+    /// \author   Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date     October 16th, 2026
+    /// \fn       atlasHash
+    /// \brief    Hashes the name of an image with 32-bit FNV-1a.
+    /// \param    name Null-terminated name of the image
+    /// \returns  the hash the entry table is sorted by.
+    ///
+    ///////////////////////////////////////////////////////////
+    inline QUInt32 atlasHash(const char *name)
+    {
+        QUInt32 hash = 2166136261u;
+        while (*name)
+        {
+            hash ^= static_cast<QUInt8>(*name++);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+}
+
+
+#endif  // __Q2D_ATLASFILE_HPP__
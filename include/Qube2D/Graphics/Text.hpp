@@ -40,23 +40,30 @@
 ///////////////////////////////////////////////////////////
 #include <Qube2D/Config.hpp>
 #include <Qube2D/System/Structs/Rect.hpp>
+#include <Qube2D/System/Structs/GLColor.hpp>
 #include <Qube2D/System/Structs/Vertices.hpp>
 #include <Qube2D/System/Localization/String.hpp>
 #include <Qube2D/Graphics/System/GraphicsEnums.hpp>
 #include <Qube2D/Graphics/System/Base/IFadable.hpp>
 #include <Qube2D/Graphics/System/Base/IMovable.hpp>
 #include <Qube2D/Graphics/System/Base/ITransformable.hpp>
+#include <Qube2D/Graphics/System/Base/ISpatial.hpp>
 #include <Qube2D/Graphics/System/OpenGL/Texture.hpp>
 #include <Qube2D/Graphics/System/OpenGL/VertexArray.hpp>
 #include <Qube2D/Graphics/System/OpenGL/VertexBuffer.hpp>
 #include <Qube2D/Graphics/System/OpenGL/ShaderProgram.hpp>
 #include <Qube2D/Graphics/Text/FontManager.hpp>
+#include <Qube2D/Graphics/Text/LayoutCache.hpp>
 #include <Qube2D/Graphics/Text/TextErrors.hpp>
 #include <Qube2D/Graphics/Text/TextEnums.hpp>
+#include <vector>
 
 
 namespace Qube2D
 {
+    struct TextCursor;
+
+
     ///////////////////////////////////////////////////////////
     /// \file    Text.hpp
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
@@ -67,7 +74,8 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     class Q2D_API Text : public IMovable,
                          public IFadable,
-                         public ITransformable
+                         public ITransformable,
+                         public ISpatial
     {
 
     public:
@@ -162,11 +170,39 @@ namespace Qube2D
         /// \brief  Specifies the text to render.
         /// \param  text UTF-32 text
         /// \param  style Combination of TextStyle flags
+        /// \note   Reuses the vertex storage of the previous call;
+        ///         only grows it if the new text needs more quads.
+        ///         Texts laid out recently with the same font and
+        ///         parameters are copied from the font's cache.
         ///
         ///////////////////////////////////////////////////////////
         void setText(const String &text,
                      TextStyle style = TextStyle::Regular);
 
+        ///////////////////////////////////////////////////////////
+        /// \fn     setIncremental
+        /// \brief  Lets setText reuse the quads of the unchanged
+        ///         beginning and end of the previous text.
+        /// \param  enabled Re-lay out only the changed characters?
+        /// \note   Meant for counters and timers that change a few
+        ///         characters per frame. Underlined or struck-through
+        ///         texts are always laid out entirely. Incremental
+        ///         texts are not added to the font's layout cache.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setIncremental(QBool enabled);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     refresh
+        /// \brief  Lays the text out again if the font evicted
+        ///         glyphs of its page since the last layout and
+        ///         marks its glyphs as recently used.
+        /// \note   Called by render and the batches; cheap if
+        ///         nothing changed.
+        ///
+        ///////////////////////////////////////////////////////////
+        void refresh();
+
 
         ///////////////////////////////////////////////////////////
         /// \fn     render
@@ -183,8 +219,33 @@ namespace Qube2D
         void render();
 
 
+        ///////////////////////////////////////////////////////////
+        /// \fn       font -> const
+        /// \brief    Retrieves the font the text is rendered with.
+        /// \returns  the font passed to setFont or NULL.
+        ///
+        ///////////////////////////////////////////////////////////
+        Font *font() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       bounds -> const
+        /// \brief    Retrieves the axis-aligned bounds on screen.
+        /// \returns  the transformed text area, in window coordinates.
+        ///
+        ///////////////////////////////////////////////////////////
+        RectF bounds() const;
+
+
     #ifdef __Q2D_LIBRARY__
 
+        ///////////////////////////////////////////////////////////
+        /// \fn       texture -> const
+        /// \brief    Retrieves the font page the text was laid out in.
+        /// \returns  the texture holding the glyphs of the text.
+        ///
+        ///////////////////////////////////////////////////////////
+        const Texture &texture() const;
+
         ///////////////////////////////////////////////////////////
         /// \fn     initializeGL
         /// \brief  Creates all static OpenGL objects.
@@ -204,6 +265,102 @@ namespace Qube2D
 
     private:
 
+        ///////////////////////////////////////////////////////////
+        /// \fn     boundsChanged
+        /// \brief  Queues the object for a spatial index update.
+        ///
+        ///////////////////////////////////////////////////////////
+        void boundsChanged();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     layout
+        /// \brief  Generates and uploads the quads of the text.
+        ///
+        ///////////////////////////////////////////////////////////
+        void layout();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       layoutOnce
+        /// \brief    Generates the quads into the staging area.
+        /// \returns  FALSE if caching a glyph evicted others of the
+        ///           page, which may leave earlier quads stale.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool layoutOnce();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     layoutSpan
+        /// \brief  Generates the quads of a range of characters.
+        /// \param  text Text to lay out
+        /// \param  begin Index of the first character
+        /// \param  end Index behind the last character
+        /// \param  cursor Pen and region pointers to advance
+        ///
+        ///////////////////////////////////////////////////////////
+        void layoutSpan(const String &text, QUInt32 begin,
+                        QUInt32 end, TextCursor &cursor);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       relayout
+        /// \brief    Lays out only the characters that differ from
+        ///           the previous text and uploads the changed quads.
+        /// \param    text New text, in the current style
+        /// \returns  FALSE if the whole text must be laid out.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool relayout(const String &text);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       layoutKey -> const
+        /// \brief    Describes the current text and parameters.
+        /// \returns  the key of the layout in the font's cache.
+        ///
+        ///////////////////////////////////////////////////////////
+        TextLayoutKey layoutKey() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       restore
+        /// \brief    Takes over the quads of an equal text laid out
+        ///           before with the same font.
+        /// \returns  FALSE if the layout is not cached or stale.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool restore();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     upload
+        /// \brief  Uploads all staged quads to the vertex buffer.
+        ///
+        ///////////////////////////////////////////////////////////
+        void upload();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     updateBounds
+        /// \brief  Determines the local hull of the staged quads.
+        ///
+        ///////////////////////////////////////////////////////////
+        void updateBounds();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     drawQuads
+        /// \brief  Draws consecutive quads of the vertex buffer.
+        /// \param  first Index of the first quad
+        /// \param  count Amount of quads to draw
+        ///
+        ///////////////////////////////////////////////////////////
+        static void drawQuads(QUInt32 first, QUInt32 count);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     passEdges -> const
+        /// \brief  Retrieves the distance field thresholds of a pass.
+        /// \param  pass Regular, Outline or DropShadow
+        /// \param  edge Outer edge, inner edge and softness; all
+        ///         zero if the glyphs are bitmaps
+        ///
+        ///////////////////////////////////////////////////////////
+        void passEdges(TextStyle pass, QFloat *edge) const;
+
+
         ///////////////////////////////////////////////////////////
         // Class members
         //
@@ -212,21 +369,36 @@ namespace Qube2D
         Font *m_Font;                   ///< Font to use
         GLColor m_Color;                ///< Text color
         GLColor m_OutlineColor;         ///< Outline color
-        QUInt32 m_VertexCount;          ///< Vertex count
-        QUInt32 m_OutlineVertexCount;   ///< Outline vertex count
-        QUInt32 m_ShadowVertexCount;    ///< Drop shadow vertex count
+        std::vector<float> m_Staging;   ///< Reused vertex staging area
+        std::vector<float> m_Scratch;   ///< Staging area of relayout
+        std::vector<QUInt32> m_CharQuads; ///< First quad of each character
+        std::vector<QFloat> m_CharPens; ///< Pen position of each character
+        String m_Text;                  ///< Text of the last layout
+        QUInt32 m_Page;                 ///< Font page of the glyphs
+        QUInt32 m_Generation;           ///< Page generation at layout
+        QUInt32 m_Stamp;                ///< Font clock its glyphs carry
+        QUInt32 m_BufferSize;           ///< Allocated bytes of the buffer
+        QUInt32 m_QuadCount;            ///< Regular quad count
+        QUInt32 m_OutlineQuadCount;     ///< Outline quad count
+        QUInt32 m_ShadowQuadCount;      ///< Drop shadow quad count
         QUInt32 m_Size;                 ///< Text size
         TextStyle m_Style;              ///< Text style
         QFloat m_OutlineWidth;          ///< Outline width
         QFloat m_LineWidth;             ///< Underline & Strikethrough width
         QFloat m_ShadowX;               ///< X-shadow offset
         QFloat m_ShadowY;               ///< Y-shadow offset
+        RectF m_LocalBounds;            ///< Untransformed vertex hull
+        QFloat m_GlyphScale;            ///< Scale of the glyph metrics
+        QBool m_DistanceField;          ///< Glyphs are distance fields?
+        QBool m_Incremental;            ///< Re-lay out changes only?
+        QBool m_LayoutValid;            ///< Per-character data valid?
 
         ///////////////////////////////////////////////////////////
         // Static class members
         //
         ///////////////////////////////////////////////////////////
         static VertexArray m_VertexArray;       ///< Texture vertex array
+        static VertexBuffer m_IndexBuffer;      ///< Shared quad indices
         static ShaderProgram m_ShaderProgram;   ///< Texture shader program
         static Shader m_VertexShader;           ///< Texture vertex shader
         static Shader m_FragShader;             ///< Texture frag. shader
@@ -234,6 +406,15 @@ namespace Qube2D
         static QInt32 m_UniformMatrix;          ///< MVP variable loc
         static QInt32 m_UniformOpacity;         ///< Opacity variable loc
         static QInt32 m_UniformColor;           ///< Uniform text color
+        static QInt32 m_UniformEdge;            ///< Distance field edges
+
+
+        ///////////////////////////////////////////////////////////
+        // Friend classes
+        //
+        ///////////////////////////////////////////////////////////
+        friend class TextBatch;
+
     };
 }
 
@@ -42,8 +42,18 @@
 #include <Qube2D/System/Storage/Atlas.hpp>
 #include <Qube2D/System/Localization/String.hpp>
 #include <Qube2D/Graphics/Text/Glyph.hpp>
+#include <Qube2D/Graphics/Text/GlyphTable.hpp>
+#include <Qube2D/Graphics/Text/GlyphRasterizer.hpp>
+#include <Qube2D/Graphics/Text/LayoutCache.hpp>
 #include <Qube2D/Graphics/Text/TextEnums.hpp>
 #include <Qube2D/Graphics/System/OpenGL/Texture.hpp>
+#include <Qube2D/Graphics/System/OpenGL/VertexBuffer.hpp>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
 
 
 ///////////////////////////////////////////////////////////
@@ -57,6 +67,21 @@ struct FT_LibraryRec_;
 
 namespace Qube2D
 {
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define FONT_PAGE_COUNT         6
+    #define FONT_SDF_PAGE           5
+    #define FONT_SDF_SIZE           48
+    #define FONT_SDF_SPREAD         6
+    #define FONT_SDF_KEY            (0x80000000u | FONT_SDF_SIZE)
+    #define FONT_EVICT_DIVISOR      8
+    #define FONT_JOB_KEY(s,l,c)     ((static_cast<QUInt64>(s) << 32) | ((l) << 24) | (c))
+    #define FONT_KERNING_KEY(s,p,c) ((static_cast<QUInt64>(s) << 42) | (static_cast<QUInt64>(p) << 21) | (c))
+    #define FONT_KERNING_CP_MASK    0x1FFFFFu
+
+
     ///////////////////////////////////////////////////////////
     /// \file    Font.hpp
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
@@ -64,6 +89,23 @@ namespace Qube2D
     /// \class   Font
     /// \brief   Loads, generates and caches glyphs.
     ///
+    /// By default, every size range is rasterized into its own
+    /// page and bold or outlined glyphs are cached separately.
+    /// In distance field mode, each glyph is rasterized once at
+    /// FONT_SDF_SIZE into a signed distance field; the metrics
+    /// are scaled to the requested size and the text shader
+    /// derives bold, outline and shadow from the same glyph.
+    ///
+    /// Once a page is full, the glyphs least recently laid out
+    /// or drawn are evicted to make room; those of the layout in
+    /// progress are never evicted. Every eviction bumps the
+    /// generation of the page, which tells the texts using it
+    /// to lay themselves out again.
+    ///
+    /// With worker threads, missing glyphs are rasterized in
+    /// the background and uploaded once per frame; until then
+    /// they only advance the pen.
+    ///
     ///////////////////////////////////////////////////////////
     class Q2D_API Font : Uncopyable
     {
@@ -78,9 +120,10 @@ namespace Qube2D
         /// \brief  Initializes a new instance of Qube2D::Font.
         ///
         /// Loads the font from the given FreeType2 FontFace.
+        /// The path allows worker threads to load their own.
         ///
         ///////////////////////////////////////////////////////////
-        Font(FT_FaceRec_ *face);
+        Font(FT_FaceRec_ *face, const char *path);
 
         ///////////////////////////////////////////////////////////
         /// \fn     Destructor
@@ -143,6 +186,16 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         const Glyph &glyph(QUInt32 cp, TextStyle style) const;
 
+        ///////////////////////////////////////////////////////////
+        /// \fn       fetch
+        /// \brief    Retrieves the glyph, caching it if necessary.
+        /// \param    cp Codepoint of the character to fetch
+        /// \param    style Style of the glyph
+        /// \returns  the glyph or an empty one if it failed to load.
+        ///
+        ///////////////////////////////////////////////////////////
+        const Glyph &fetch(QUInt32 cp, TextStyle style);
+
         ///////////////////////////////////////////////////////////
         /// \fn       texture -> const
         /// \brief    Retrieves the texture of the current size.
@@ -152,13 +205,89 @@ namespace Qube2D
         const Texture &texture() const;
 
         ///////////////////////////////////////////////////////////
-        /// \fn     kerning -> const
-        /// \brief  Retrieves the kerning of two characters.
-        /// \param  prev Previous character
+        /// \fn       texture -> const
+        /// \brief    Retrieves the texture of the given page.
+        /// \param    page Page returned by Font::page
+        /// \returns  the texture of the page.
+        ///
+        ///////////////////////////////////////////////////////////
+        const Texture &texture(QUInt32 page) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       page -> const
+        /// \brief    Retrieves the page of the current size.
+        /// \returns  the index of the page glyphs are packed in.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 page() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       generation -> const
+        /// \brief    Retrieves the eviction count of a page.
+        /// \param    page Page returned by Font::page
+        /// \returns  a value that changes whenever glyphs of the
+        ///           page were evicted.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 generation(QUInt32 page) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       clock -> const
+        /// \brief    Retrieves the stamp of the current layout.
+        /// \returns  a value that changes on every layout.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 clock() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     touch
+        /// \brief  Marks the glyphs of a text as recently used.
+        /// \param  text Text whose glyphs to mark
+        /// \param  size Size the text was laid out with
+        /// \param  style Style the text was laid out with
+        /// \param  distanceField Was laid out with distance fields?
+        /// \note   Keeps the glyphs of drawn texts from being evicted
+        ///         before those no text has shown for a while.
+        ///
+        ///////////////////////////////////////////////////////////
+        void touch(const String &text, QUInt32 size, TextStyle style, QBool distanceField);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     kerning
+        /// \brief  Retrieves the kerning of two characters at the
+        ///         current size.
+        /// \param  prev Previous character, zero if none
         /// \param  cur Current character
+        /// \note   Asks FreeType only once per pair and size.
         ///
         ///////////////////////////////////////////////////////////
-        QFloat kerning(QUInt32 prev, QUInt32 cur) const;
+        QFloat kerning(QUInt32 prev, QUInt32 cur);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       scale -> const
+        /// \brief    Retrieves the factor to apply to glyph metrics.
+        /// \returns  the requested size divided by the size the
+        ///           glyphs were rasterized at; 1 for bitmaps.
+        ///
+        ///////////////////////////////////////////////////////////
+        QFloat scale() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       layouts
+        /// \brief    Retrieves the layouts of texts using the font.
+        /// \returns  the cache shared by all texts of the font.
+        ///
+        ///////////////////////////////////////////////////////////
+        LayoutCache &layouts();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     upload
+        /// \brief  Packs and uploads the glyphs finished by the
+        ///         workers with one buffer transfer.
+        /// \note   Must be called on the OpenGL thread.
+        ///
+        ///////////////////////////////////////////////////////////
+        void upload();
 
 
         ///////////////////////////////////////////////////////////
@@ -190,6 +319,41 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         void cacheSubset(Subset set, QUInt32 size, TextStyle style);
 
+        ///////////////////////////////////////////////////////////
+        /// \fn     setDistanceField
+        /// \brief  Renders glyphs as signed distance fields.
+        /// \param  enabled TRUE to serve every size from one page
+        /// \note   Must be called before any text uses the font.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setDistanceField(QBool enabled);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       isDistanceField -> const
+        /// \brief    Determines whether glyphs are distance fields.
+        /// \returns  TRUE if the distance field mode is enabled.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool isDistanceField() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     setThreadCount
+        /// \brief  Rasterizes missing glyphs on worker threads.
+        /// \param  count Amount of workers; 0 rasterizes glyphs
+        ///         synchronously, which is the default
+        ///
+        ///////////////////////////////////////////////////////////
+        void setThreadCount(QUInt32 count);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     setLayoutCacheSize
+        /// \brief  Specifies how many text layouts are kept for
+        ///         repeated strings.
+        /// \param  count Amount of layouts; 0 disables the cache
+        ///
+        ///////////////////////////////////////////////////////////
+        void setLayoutCacheSize(QUInt32 count);
+
         ///////////////////////////////////////////////////////////
         /// \fn       measureString
         /// \brief    Measures the width and height of a string.
@@ -197,12 +361,33 @@ namespace Qube2D
         /// \param    style Style of the glyph
         /// \param    size Size of the glyphs in pixels
         /// \returns  the width and height, in pixels.
+        /// \note     Only reads glyph metrics; never rasterizes
+        ///           glyphs or touches OpenGL and may therefore be
+        ///           called from any thread.
         ///
         ///////////////////////////////////////////////////////////
         SizeF measureString(const String &string,
                             TextStyle style,
                             QUInt32 size);
 
+        ///////////////////////////////////////////////////////////
+        /// \fn       wrapString
+        /// \brief    Breaks a string into lines of limited width.
+        /// \param    string Qube2D::String to break
+        /// \param    style Style of the glyph
+        /// \param    size Size of the glyphs in pixels
+        /// \param    width Maximum width of a line, in pixels
+        /// \returns  the string with spaces at the line ends turned
+        ///           into new-lines; words wider than a line are
+        ///           broken between two characters.
+        /// \note     May be called from any thread, like measureString.
+        ///
+        ///////////////////////////////////////////////////////////
+        String wrapString(const String &string,
+                          TextStyle style,
+                          QUInt32 size,
+                          QFloat width);
+
         ///////////////////////////////////////////////////////////
         /// \fn     saveFontTexture
         /// \brief  Saves the font texture for debugging purposes.
@@ -211,9 +396,126 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         void saveFontTexture(const char *path);
 
+        ///////////////////////////////////////////////////////////
+        /// \fn       saveCache
+        /// \brief    Writes all cached glyphs and their pages.
+        /// \param    path File to write the cache to
+        /// \returns  FALSE if the font or cache file failed to open.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool saveCache(const char *path);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       loadCache
+        /// \brief    Restores glyphs written by saveCache.
+        /// \param    path File to read the cache from
+        /// \returns  FALSE if the file is missing, damaged or was
+        ///           written for another font file or version.
+        /// \note     Replaces all glyphs; must be called before
+        ///           any text uses the font.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool loadCache(const char *path);
+
 
     private:
 
+        ///////////////////////////////////////////////////////////
+        /// \fn       charIndex
+        /// \brief    Retrieves the glyph index of a character.
+        /// \param    cp Codepoint of the character
+        /// \returns  the index within the face; zero if missing.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 charIndex(QUInt32 cp);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     cacheKerning
+        /// \brief  Determines the kerning of all pairs of a range
+        ///         of characters at the current size.
+        /// \param  min First character of the range
+        /// \param  max Character behind the range
+        ///
+        ///////////////////////////////////////////////////////////
+        void cacheKerning(QUInt32 min, QUInt32 max);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       openMetrics
+        /// \brief    Loads the face used for measuring, if not yet.
+        /// \returns  FALSE if the font file could not be loaded.
+        /// \note     Requires 'm_MetricsMutex' to be locked.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool openMetrics();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       advanceOf
+        /// \brief    Determines how far a character moves the pen,
+        ///           the same way Text lays it out.
+        /// \param    prev Previous glyph, for kerning; zero if none
+        /// \param    cp Codepoint of the character
+        /// \param    style Style of the text
+        /// \param    size Size of the glyphs in pixels
+        /// \param    distanceField Snapshot of 'm_DistanceField'
+        /// \returns  the advance, including kerning, in pixels.
+        /// \note     Requires 'm_MetricsMutex' to be locked.
+        ///
+        ///////////////////////////////////////////////////////////
+        QFloat advanceOf(QUInt32 prev, QUInt32 cp, TextStyle style, QUInt32 size, QBool distanceField);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       slotOf -> const
+        /// \brief    Determines the glyph slot of a style.
+        /// \returns  the regular slot in distance field mode.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 slotOf(TextStyle style) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       makeJob -> const
+        /// \brief    Describes a glyph of the current size.
+        /// \param    cp Codepoint of the character
+        /// \param    style Style of the glyph
+        /// \returns  the job to rasterize the glyph with.
+        ///
+        ///////////////////////////////////////////////////////////
+        GlyphJob makeJob(QUInt32 cp, TextStyle style) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       store
+        /// \brief    Packs a rasterized glyph and caches it.
+        /// \param    bitmap Glyph to store
+        /// \param    space Receives the texture region to fill;
+        ///           invalid for whitespace
+        /// \returns  FALSE if the glyph does not fit into a page.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool store(const GlyphBitmap &bitmap, RectI &space);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       allocate
+        /// \brief    Finds space in a page for a glyph.
+        /// \param    page Page to pack the glyph in
+        /// \param    width Width of the glyph, including padding
+        /// \param    height Height of the glyph, including padding
+        /// \returns  the space or an invalid rect, if too big.
+        ///
+        /// Evicts the least recently used glyphs of the page until
+        /// the glyph fits. Glyphs stamped with the current clock
+        /// stay, thus the space stays invalid if they fill the page.
+        ///
+        ///////////////////////////////////////////////////////////
+        RectI allocate(QUInt32 page, QInt32 width, QInt32 height);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     evict
+        /// \brief  Removes a glyph and frees its space in the page.
+        /// \param  ref Glyph to remove
+        ///
+        ///////////////////////////////////////////////////////////
+        void evict(const GlyphRef &ref);
+
+
         ///////////////////////////////////////////////////////////
         // Class members
         //
@@ -222,10 +524,29 @@ namespace Qube2D
         Texture *m_Textures;       ///< OpenGL texture array
         Atlas<2048> *m_Packer;     ///< Packs glyphs into a texture
         QUInt32 m_Size;            ///< Currently active size
+        QUInt32 m_Requested;       ///< Size requested by extract
         QUInt32 m_Page;            ///< Currently active page
-        QFloat m_OutlineWidth;     ///< Width of the outline
-        std::map<QUInt32, GlyphAtlas> m_Atlas;
+        QUInt32 m_Clock;           ///< Incremented on every extract
+        QUInt32 m_Generations[FONT_PAGE_COUNT]; ///< Evictions per page
+        std::atomic<QFloat> m_OutlineWidth; ///< Width of the outline
+        std::atomic<QBool> m_DistanceField; ///< Glyphs are distance fields?
+        GlyphTable m_Glyphs;       ///< Cached glyphs of all sizes
         std::map<QUInt32, QInt32> m_Bearings;
+        std::unordered_map<QUInt32, QUInt32> m_CharIndices; ///< Glyph index per character
+        std::unordered_map<QUInt64, QFloat> m_Kerning;      ///< Kerning per size and pair
+        std::set<QUInt64> m_KernedRanges; ///< Precomputed ranges per size
+        std::string m_Path;        ///< Font file, for the workers
+        GlyphRasterizer m_Rasterizer; ///< Background rasterization
+        std::set<QUInt64> m_Pending;  ///< Glyphs queued for workers
+        Glyph m_Placeholder;       ///< Stands in for queued glyphs
+        VertexBuffer m_UploadBuffer;  ///< Pixel unpack buffer
+        LayoutCache m_Layouts;     ///< Recently laid out texts
+        std::mutex m_MetricsMutex; ///< Guards all measuring members
+        FT_LibraryRec_ *m_MetricsLibrary; ///< Library of the metrics face
+        FT_FaceRec_ *m_MetricsFace;   ///< Face used for measuring only
+        std::unordered_map<QUInt64, QFloat> m_Advances; ///< Unscaled advances
+        std::unordered_map<QUInt32, QUInt32> m_MetricIndices; ///< Glyph indices
+        LayoutCache m_Measures;    ///< Recently measured strings
 
     };
 }
@@ -87,6 +87,14 @@ namespace Qube2D
 
     #ifdef __Q2D_LIBRARY__
 
+        ///////////////////////////////////////////////////////////
+        /// \fn     uploadGlyphs
+        /// \brief  Uploads the glyphs rasterized by font workers.
+        /// \note   Called once per frame, before rendering.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void uploadGlyphs();
+
         static bool initializeFT2();
         static void destroyFT2();
 
@@ -39,7 +39,6 @@
 //
 ///////////////////////////////////////////////////////////
 #include <Qube2D/Config.hpp>
-#include <map>
 
 
 namespace Qube2D
@@ -64,22 +63,8 @@ namespace Qube2D
         QInt32 bearing_x = 0;   ///< Horizontal bearing
         QInt32 bearing_y = 0;   ///< Vertical bearing
         QFloat advance = 0;     ///< Distance to next glyph
-    };
-
-    ///////////////////////////////////////////////////////////
-    /// \file    GlyphAtlas.hpp
-    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
-    /// \date    September 14th, 2016
-    /// \struct  GlyphAtlas
-    /// \brief   Stores glyphs of various sizes and types.
-    ///
-    ///////////////////////////////////////////////////////////
-    struct GlyphAtlas
-    {
-        std::map<QUInt32, Glyph> glyphs;        ///< Normal glyphs
-        std::map<QUInt32, Glyph> glyphsBold;    ///< Bold glyphs
-        std::map<QUInt32, Glyph> glyphsOutline; ///< Outlined glyphs
-        std::map<QUInt32, Glyph> glyphsBorder;  ///< Bordered glyphs
+        QUInt32 atlas_page = 0; ///< Font page the glyph is packed in
+        QUInt32 last_used = 0;  ///< Clock when it was last laid out or drawn
     };
 }
 
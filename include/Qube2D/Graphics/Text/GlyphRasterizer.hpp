@@ -0,0 +1,230 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_GLYPHRASTERIZER_HPP__
+#define __Q2D_GLYPHRASTERIZER_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/System/Uncopyable.hpp>
+#include <Qube2D/Graphics/Text/TextEnums.hpp>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Forward declarations
+//
+///////////////////////////////////////////////////////////
+struct FT_FaceRec_;
+struct FT_StrokerRec_;
+struct FT_LibraryRec_;
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    GlyphRasterizer.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \struct  GlyphJob
+    /// \brief   Describes one glyph to rasterize.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct GlyphJob
+    {
+        QUInt32 cp;             ///< Codepoint of the character
+        QUInt32 size;           ///< Pixel size to rasterize at
+        QUInt32 key;            ///< Size key of the glyph table
+        QUInt32 slot;           ///< One of the GLYPH_SLOT_* constants
+        QUInt32 page;           ///< Font page to pack the glyph in
+        TextStyle style;        ///< Style of the glyph
+        QFloat outlineWidth;    ///< Width of the outline, if any
+        QBool distanceField;    ///< Rasterize a distance field?
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    GlyphRasterizer.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \struct  GlyphBitmap
+    /// \brief   Holds the pixels and metrics of a glyph.
+    ///
+    /// The pixels are tightly packed, one byte per pixel. The
+    /// vertical bearing is relative to the baseline; the font
+    /// converts it to the top of the line.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct GlyphBitmap
+    {
+        GlyphJob job;                   ///< Job that yielded the glyph
+        std::vector<QUInt8> pixels;     ///< Coverage or distance field
+        QInt32 width = 0;               ///< Width in pixels
+        QInt32 height = 0;              ///< Height in pixels
+        QFloat bearingX = 0;            ///< Horizontal bearing
+        QFloat bearingY = 0;            ///< Height above the baseline
+        QFloat advance = 0;             ///< Distance to next glyph
+        QBool failed = false;           ///< Could not be rendered?
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    GlyphRasterizer.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \class   GlyphRasterizer
+    /// \brief   Rasterizes glyphs on worker threads.
+    ///
+    /// FreeType objects must not be shared between threads,
+    /// thus every worker loads the font file into a library,
+    /// face and stroker of its own. Requested glyphs are
+    /// rendered into CPU memory; the thread owning the OpenGL
+    /// context collects and uploads them.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API GlyphRasterizer : Uncopyable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance without workers.
+        ///
+        ///////////////////////////////////////////////////////////
+        GlyphRasterizer();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Destructor
+        /// \brief  Stops and joins all workers.
+        ///
+        ///////////////////////////////////////////////////////////
+        ~GlyphRasterizer();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       start
+        /// \brief    Loads the font once per worker and runs them.
+        /// \param    path Absolute path to the font file
+        /// \param    threads Amount of workers to run
+        /// \returns  FALSE if not a single worker could be set up.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool start(const std::string &path, QUInt32 threads);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     stop
+        /// \brief  Drops all pending jobs and joins the workers.
+        ///
+        ///////////////////////////////////////////////////////////
+        void stop();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     request
+        /// \brief  Queues a glyph for rasterization.
+        /// \param  job Glyph to rasterize
+        ///
+        ///////////////////////////////////////////////////////////
+        void request(const GlyphJob &job);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     collect
+        /// \brief  Takes all glyphs finished so far.
+        /// \param  done Receives the finished glyphs
+        ///
+        ///////////////////////////////////////////////////////////
+        void collect(std::vector<GlyphBitmap> &done);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       isRunning -> const
+        /// \brief    Determines whether workers are running.
+        /// \returns  TRUE if glyphs are rasterized asynchronously.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool isRunning() const;
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       rasterize
+        /// \brief    Renders one glyph on the calling thread.
+        /// \param    face Face whose size is set to the job's
+        /// \param    stroker Stroker used for outlines
+        /// \param    library Library owning the face
+        /// \param    bitmap Receives the glyph; its job is read
+        /// \returns  FALSE if the character could not be loaded.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QBool rasterize(FT_FaceRec_ *face,
+                               FT_StrokerRec_ *stroker,
+                               FT_LibraryRec_ *library,
+                               GlyphBitmap &bitmap);
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     work
+        /// \brief  Rasterizes queued jobs until stopped.
+        /// \param  index Index of the worker's FreeType objects
+        ///
+        ///////////////////////////////////////////////////////////
+        void work(QUInt32 index);
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        std::vector<std::thread> m_Threads;         ///< Worker threads
+        std::vector<FT_LibraryRec_ *> m_Libraries;  ///< One library per worker
+        std::vector<FT_FaceRec_ *> m_Faces;         ///< One face per worker
+        std::vector<FT_StrokerRec_ *> m_Strokers;   ///< One stroker per worker
+        std::deque<GlyphJob> m_Jobs;                ///< Pending jobs
+        std::vector<GlyphBitmap> m_Done;            ///< Finished glyphs
+        std::mutex m_Mutex;                         ///< Guards jobs and results
+        std::condition_variable m_Wake;             ///< Signals new jobs
+        QBool m_Stop;                               ///< Workers should exit?
+
+    };
+}
+
+
+#endif  // __Q2D_GLYPHRASTERIZER_HPP__
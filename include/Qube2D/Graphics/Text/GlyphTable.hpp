@@ -0,0 +1,285 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_GLYPHTABLE_HPP__
+#define __Q2D_GLYPHTABLE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/Graphics/Text/Glyph.hpp>
+#include <Qube2D/Graphics/Text/TextEnums.hpp>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define GLYPH_SLOT_REGULAR      0
+    #define GLYPH_SLOT_BOLD         1
+    #define GLYPH_SLOT_OUTLINE      2
+    #define GLYPH_SLOT_BORDER       3
+    #define GLYPH_SLOT_COUNT        4
+    #define GLYPH_DIRECT_COUNT      256
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    GlyphTable.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \struct  GlyphPage
+    /// \brief   Directly indexed glyphs of one size.
+    ///
+    /// Holds the Basic Latin and Latin-1 glyphs of every style
+    /// slot, indexed by codepoint.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct GlyphPage
+    {
+        QUInt32 size;                                               ///< Pixel size
+        Glyph glyphs[GLYPH_SLOT_COUNT][GLYPH_DIRECT_COUNT];         ///< Glyph data
+        QBool isCached[GLYPH_SLOT_COUNT][GLYPH_DIRECT_COUNT];       ///< Valid data?
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    GlyphTable.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \struct  GlyphRef
+    /// \brief   Identifies one cached glyph for eviction.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct GlyphRef
+    {
+        QUInt32 size;           ///< Pixel size or font-specific key
+        QUInt32 slot;           ///< One of the GLYPH_SLOT_* constants
+        QUInt32 cp;             ///< Codepoint of the character
+        const Glyph *glyph;     ///< Cached glyph data
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    GlyphTable.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   GlyphTable
+    /// \brief   Maps (size, style, codepoint) to cached glyphs.
+    ///
+    /// Codepoints below GLYPH_DIRECT_COUNT are looked up in the
+    /// page of the current size by a plain array access. All
+    /// other glyphs live in one open-addressing hash table
+    /// with linear probing, keyed by size, slot and codepoint.
+    /// Pointers to glyphs stay valid until the glyph is
+    /// removed or the table is cleared.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API GlyphTable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of GlyphTable.
+        ///
+        ///////////////////////////////////////////////////////////
+        GlyphTable();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Destructor
+        /// \brief  Frees all pages.
+        ///
+        ///////////////////////////////////////////////////////////
+        ~GlyphTable();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       setSize
+        /// \brief    Selects the size to look up and insert glyphs.
+        /// \param    size Pixel size of the glyphs
+        /// \returns  false if the size was not used before.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool setSize(QUInt32 size);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       find -> const, inline
+        /// \brief    Looks up a glyph of the current size.
+        /// \param    cp Codepoint of the character
+        /// \param    slot One of the GLYPH_SLOT_* constants
+        /// \returns  the glyph or NULL if not cached.
+        /// \note     A size must have been selected with setSize.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline const Glyph *find(QUInt32 cp, QUInt32 slot) const
+        {
+            if (cp < GLYPH_DIRECT_COUNT)
+                return m_Page->isCached[slot][cp] ? &m_Page->glyphs[slot][cp] : NULL;
+
+            return findHashed(cp, slot);
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       find -> inline
+        /// \brief    Looks up a glyph of the current size.
+        /// \returns  the modifiable glyph or NULL if not cached.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline Glyph *find(QUInt32 cp, QUInt32 slot)
+        {
+            return const_cast<Glyph *>(static_cast<const GlyphTable *>(this)->find(cp, slot));
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       insert
+        /// \brief    Stores a glyph of the current size.
+        /// \param    cp Codepoint of the character
+        /// \param    slot One of the GLYPH_SLOT_* constants
+        /// \param    glyph Glyph data to store
+        /// \returns  the stored glyph.
+        ///
+        ///////////////////////////////////////////////////////////
+        const Glyph &insert(QUInt32 cp, QUInt32 slot, const Glyph &glyph);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     remove
+        /// \brief  Removes a glyph of any size.
+        /// \param  size Size the glyph was inserted with
+        /// \param  slot One of the GLYPH_SLOT_* constants
+        /// \param  cp Codepoint of the character
+        /// \note   Does not change the selected size.
+        ///
+        ///////////////////////////////////////////////////////////
+        void remove(QUInt32 size, QUInt32 slot, QUInt32 cp);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     collect -> const
+        /// \brief  Gathers all glyphs packed in one font page.
+        /// \param  page Value of Glyph::atlas_page to look for
+        /// \param  refs Receives the glyphs of all sizes
+        /// \note   Glyphs without pixels, e.g. spaces, are skipped.
+        ///
+        ///////////////////////////////////////////////////////////
+        void collect(QUInt32 page, std::vector<GlyphRef> &refs) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     collect -> const
+        /// \brief  Gathers all glyphs, including whitespace.
+        /// \param  refs Receives the glyphs of all sizes and pages
+        ///
+        ///////////////////////////////////////////////////////////
+        void collect(std::vector<GlyphRef> &refs) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     clear
+        /// \brief  Removes all glyphs of all sizes.
+        ///
+        ///////////////////////////////////////////////////////////
+        void clear();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       slotOf -> static, inline
+        /// \brief    Determines the slot a style is stored in.
+        /// \param    style Combination of TextStyle flags
+        /// \returns  one of the GLYPH_SLOT_* constants.
+        ///
+        ///////////////////////////////////////////////////////////
+        static inline QUInt32 slotOf(TextStyle style)
+        {
+            if (style & TextStyle::Bold)
+                return GLYPH_SLOT_BOLD;
+            else if (style & TextStyle::Outline)
+                return GLYPH_SLOT_OUTLINE;
+            else if (style & TextStyle::OutlineOnly)
+                return GLYPH_SLOT_BORDER;
+            else
+                return GLYPH_SLOT_REGULAR;
+        }
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     gather -> const
+        /// \brief  Gathers the glyphs of one or all pages.
+        /// \param  page Value of Glyph::atlas_page to look for
+        /// \param  all TRUE to ignore the page and keep whitespace
+        /// \param  refs Receives the glyphs
+        ///
+        ///////////////////////////////////////////////////////////
+        void gather(QUInt32 page, QBool all, std::vector<GlyphRef> &refs) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       findHashed -> const
+        /// \brief    Looks up a glyph outside of the direct range.
+        /// \returns  the glyph or NULL if not cached.
+        ///
+        ///////////////////////////////////////////////////////////
+        const Glyph *findHashed(QUInt32 cp, QUInt32 slot) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     grow
+        /// \brief  Doubles the hash table and re-inserts all keys.
+        ///
+        ///////////////////////////////////////////////////////////
+        void grow();
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        std::vector<GlyphPage *> m_Pages;   ///< Direct pages by size
+        std::vector<QUInt64> m_Keys;        ///< Hash keys; zero if empty
+        std::vector<QUInt32> m_Indices;     ///< Glyph of each key
+        std::deque<Glyph> m_Glyphs;         ///< Hashed glyph storage
+        std::vector<QUInt64> m_GlyphKeys;   ///< Key of each stored glyph
+        std::vector<QUInt32> m_FreeGlyphs;  ///< Reusable storage indices
+        GlyphPage *m_Page;                  ///< Page of current size
+        QUInt32 m_Size;                     ///< Current size
+
+    };
+}
+
+
+#endif  // __Q2D_GLYPHTABLE_HPP__
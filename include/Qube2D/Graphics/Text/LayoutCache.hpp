@@ -0,0 +1,235 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_LAYOUTCACHE_HPP__
+#define __Q2D_LAYOUTCACHE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Uncopyable.hpp>
+#include <Qube2D/System/Structs/Rect.hpp>
+#include <Qube2D/System/Structs/Size.hpp>
+#include <Qube2D/System/Localization/String.hpp>
+#include <Qube2D/Graphics/Text/TextEnums.hpp>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define LAYOUT_CACHE_CAPACITY   256
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    LayoutCache.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \struct  TextLayoutKey
+    /// \brief   Describes everything a layout depends on.
+    ///
+    /// The text is referenced rather than copied, so that
+    /// looking up a layout never allocates.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct TextLayoutKey
+    {
+        const String *text;     ///< Laid out or measured text
+        QUInt32 size;           ///< Requested pixel size
+        TextStyle style;        ///< Combination of TextStyle flags
+        QFloat outlineWidth;    ///< Width of the outline
+        QFloat lineWidth;       ///< Underline & strikethrough width
+        QFloat shadowX;         ///< X-shadow offset
+        QFloat shadowY;         ///< Y-shadow offset
+        QBool distanceField;    ///< Glyphs are distance fields?
+        QBool measure;          ///< Measurement rather than quads?
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    LayoutCache.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \struct  TextLayout
+    /// \brief   Ready-made glyph quads and measured bounds.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct TextLayout
+    {
+        std::vector<float> vertices;    ///< Quads of all passes, compacted
+        QUInt32 quadCount;              ///< Regular quad count
+        QUInt32 outlineQuadCount;       ///< Outline quad count
+        QUInt32 shadowQuadCount;        ///< Drop shadow quad count
+        QUInt32 page;                   ///< Font page of the glyphs
+        QUInt32 generation;             ///< Page generation at layout
+        QFloat glyphScale;              ///< Scale of the glyph metrics
+        RectF bounds;                   ///< Untransformed vertex hull
+        SizeF size;                     ///< Measured width and height
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    LayoutCache.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \class   LayoutCache
+    /// \brief   Bounded LRU cache of text layouts.
+    ///
+    /// Entries are looked up by a hash of the whole key and
+    /// compared in full on a hit. A key is only admitted the
+    /// second time it is inserted, so that strings laid out a
+    /// single time, like timers, do not replace layouts which
+    /// are used again. Rejecting such a string costs a single
+    /// table lookup and never allocates. Once the capacity is
+    /// reached, the least recently used entry is replaced.
+    /// Layouts keep the page generation they were made at;
+    /// the caller has to discard them if glyphs of the page
+    /// were evicted.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API LayoutCache : Uncopyable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of LayoutCache.
+        ///
+        ///////////////////////////////////////////////////////////
+        LayoutCache();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     setCapacity
+        /// \brief  Specifies the maximum amount of layouts.
+        /// \param  capacity Amount of layouts; 0 disables the cache
+        ///
+        ///////////////////////////////////////////////////////////
+        void setCapacity(QUInt32 capacity);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       find
+        /// \brief    Looks up the layout of a key.
+        /// \param    key Text and parameters of the layout
+        /// \returns  the layout or NULL if not cached.
+        /// \note     Marks the layout as most recently used.
+        ///
+        ///////////////////////////////////////////////////////////
+        TextLayout *find(const TextLayoutKey &key);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       insert
+        /// \brief    Retrieves the layout to fill for a key.
+        /// \param    key Text and parameters of the layout
+        /// \returns  the new or previous layout of the key; NULL
+        ///           if the cache is disabled or the key is not
+        ///           admitted yet.
+        /// \note     Replaces the least recently used layout if the
+        ///           cache is full; reuses its vertex storage.
+        ///
+        ///////////////////////////////////////////////////////////
+        TextLayout *insert(const TextLayoutKey &key);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     clear
+        /// \brief  Removes all layouts.
+        ///
+        ///////////////////////////////////////////////////////////
+        void clear();
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \struct  Entry
+        /// \brief   Key and layout of one cached text.
+        ///
+        ///////////////////////////////////////////////////////////
+        struct Entry
+        {
+            QUInt64 hash;           ///< Hash of the key
+            String text;            ///< Copy of the text of the key
+            TextLayoutKey key;      ///< Full key, for comparison
+            TextLayout layout;      ///< Cached layout
+        };
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       hash
+        /// \brief    Hashes the text and all parameters of a key.
+        /// \returns  the 64-bit FNV-1a hash.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QUInt64 hash(const TextLayoutKey &key);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       equals
+        /// \brief    Compares two keys member by member.
+        /// \returns  TRUE if both describe the same layout.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QBool equals(const TextLayoutKey &a, const TextLayoutKey &b);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       admit
+        /// \brief    Remembers the hash of a key not cached yet.
+        /// \returns  TRUE if the hash was remembered before.
+        /// \note     Takes constant time; each hash is remembered
+        ///           in the slot it maps to.
+        ///
+        ///////////////////////////////////////////////////////////
+        QBool admit(QUInt64 hash);
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        std::list<Entry> m_Entries;     ///< Most recently used first
+        std::unordered_map<QUInt64, std::list<Entry>::iterator> m_Lookup;
+        std::vector<QUInt64> m_Candidates;  ///< Hashes inserted once
+        QUInt32 m_Capacity;             ///< Maximum amount of entries
+
+    };
+}
+
+
+#endif  // __Q2D_LAYOUTCACHE_HPP__
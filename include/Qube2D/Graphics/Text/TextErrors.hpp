@@ -64,6 +64,8 @@ namespace Qube2D
     #define Q2D_FONT_ERROR_0 "An invalid font size was specified.\n    Font: %0, Size: %1"
     #define Q2D_FONT_ERROR_1 "Could not render a character.\n    Font: %0, Unichar: %1"
     #define Q2D_FONT_ERROR_2 "Running out of texture space!\n    Font: %0, Unichar: %1"
+    #define Q2D_FONT_ERROR_3 "No glyph worker could load the font.\n    Font: %0"
+    #define Q2D_FONT_ERROR_4 "The font could not be loaded for measuring.\n    Font: %0"
 }
 
 
@@ -0,0 +1,217 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_TEXTBATCH_HPP__
+#define __Q2D_TEXTBATCH_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Uncopyable.hpp>
+#include <Qube2D/System/Structs/Transform.hpp>
+#include <Qube2D/System/Structs/Vertices.hpp>
+#include <Qube2D/Graphics/Text.hpp>
+#include <Qube2D/Graphics/System/OpenGL/VertexArray.hpp>
+#include <Qube2D/Graphics/System/OpenGL/VertexBuffer.hpp>
+#include <Qube2D/Graphics/System/OpenGL/ShaderProgram.hpp>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    TextBatch.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   TextBatch : Uncopyable
+    /// \brief   Merges many text draws into few draw calls.
+    ///
+    /// Texts passed to TextBatch::draw have their glyph quads
+    /// transformed on the CPU and appended to one vertex
+    /// buffer. Color, opacity and the distance field edges of
+    /// each pass become vertex attributes, so one draw call is
+    /// issued for each consecutive run of texts sharing the
+    /// same font texture. The drop shadow, outline and fill of
+    /// each text keep their order.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API TextBatch : Uncopyable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of Qube2D::TextBatch.
+        ///
+        ///////////////////////////////////////////////////////////
+        TextBatch();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     create
+        /// \brief  Creates all OpenGL-related objects.
+        /// \param  capacity Maximum amount of glyph quads per draw
+        /// \note   The capacity is limited to 16384 quads, since
+        ///         the batch uses 16-bit indices.
+        ///
+        ///////////////////////////////////////////////////////////
+        void create(QUInt32 capacity = 8192);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     destroy
+        /// \brief  Destroys all OpenGL-related objects.
+        ///
+        ///////////////////////////////////////////////////////////
+        void destroy();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     begin
+        /// \brief  Starts a new batch and resets the statistics.
+        ///
+        ///////////////////////////////////////////////////////////
+        void begin();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     draw
+        /// \brief  Appends the given text to the batch.
+        /// \param  text Text to draw; setText must have been called
+        /// \note   Flushes the batch beforehand if the font texture
+        ///         differs from the previous text, and whenever
+        ///         the batch is full. Refreshes the text first if
+        ///         its glyphs were evicted.
+        ///
+        ///////////////////////////////////////////////////////////
+        void draw(Text &text);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     flush
+        /// \brief  Renders all pending quads in one draw call.
+        ///
+        ///////////////////////////////////////////////////////////
+        void flush();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     end
+        /// \brief  Renders all pending quads and ends the batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        void end();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       drawCalls -> const
+        /// \brief    Retrieves the draw calls issued since begin.
+        /// \returns  the amount of draw calls of the current batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 drawCalls() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       textCount -> const
+        /// \brief    Retrieves the texts drawn since begin.
+        /// \returns  the amount of texts of the current batch.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 textCount() const;
+
+
+    #ifdef __Q2D_LIBRARY__
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     initializeGL
+        /// \brief  Creates the text batch program.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void initializeGL();
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     destroyGL
+        /// \brief  Destroys the text batch program.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void destroyGL();
+
+    #endif
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     addQuads
+        /// \brief  Transforms and colors quads of a text.
+        /// \param  quads First quad within the text's vertex data
+        /// \param  count Amount of quads to append
+        /// \param  model Model transform of the text
+        /// \param  color Color of all quads, including opacity
+        /// \param  edge Distance field edges of the pass
+        ///
+        ///////////////////////////////////////////////////////////
+        void addQuads(const float *quads,
+                      QUInt32 count,
+                      const Transform &model,
+                      const GLColor &color,
+                      const QFloat *edge);
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        VertexArray m_VertexArray;              ///< Batch vertex array
+        VertexBuffer m_IndexBuffer;             ///< Static quad indices
+        std::vector<TextVertex> m_Vertices;     ///< Pending vertices
+        QUInt32 m_Capacity;                     ///< Max. quads per draw
+        QUInt32 m_Count;                        ///< Pending quads
+        QUInt32 m_Texture;                      ///< Font texture of the run
+        QUInt32 m_DrawCalls;                    ///< Draw calls since begin
+        QUInt32 m_TextCount;                    ///< Texts since begin
+
+        ///////////////////////////////////////////////////////////
+        // Static class members
+        //
+        ///////////////////////////////////////////////////////////
+        static ShaderProgram m_ShaderProgram;   ///< Text batch program
+        static Shader m_VertexShader;           ///< Text batch vert. shader
+        static Shader m_FragShader;             ///< Text batch frag. shader
+        static QInt32 m_UniformSampler;         ///< Sampler2D variable loc
+        static QInt32 m_UniformMatrix;          ///< MVP variable loc
+    };
+}
+
+
+#endif  // __Q2D_TEXTBATCH_HPP__
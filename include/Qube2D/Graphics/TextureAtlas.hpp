@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_TEXTUREATLAS_HPP__
+#define __Q2D_TEXTUREATLAS_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Uncopyable.hpp>
+#include <Qube2D/System/Storage/Atlas.hpp>
+#include <Qube2D/Graphics/System/OpenGL/Texture.hpp>
+#include <Qube2D/Graphics/System/Structs/TextureRegion.hpp>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    TextureAtlas.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   TextureAtlas : Uncopyable
+    /// \brief   Packs small images into shared RGBA pages.
+    ///
+    /// Each page is a 2048x2048 texture whose space is managed
+    /// by a Qube2D::Atlas. Images are surrounded by a border of
+    /// the given padding, filled with their extruded edge pixels,
+    /// so that linear filtering does not bleed in neighbours.
+    /// A new page is started once an image fits in no page.
+    ///
+    /// Sprites loaded with a Qube2D::TextureRegion share the
+    /// page texture, so sprites of the same page can be drawn
+    /// by one Qube2D::SpriteBatch run.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Q2D_API TextureAtlas : Uncopyable
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Default constructor
+        /// \brief  Initializes a new instance of Qube2D::TextureAtlas.
+        ///
+        ///////////////////////////////////////////////////////////
+        TextureAtlas();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     create
+        /// \brief  Specifies how the images are packed.
+        /// \param  padding Extruded pixels around each image
+        /// \param  filter Interpolation mode of all pages
+        /// \note   Pages are created lazily, on the first load.
+        ///
+        ///////////////////////////////////////////////////////////
+        void create(QUInt32 padding = 1,
+                    InterpolationMode filter = InterpolationMode::NearestNeighbor);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     destroy
+        /// \brief  Destroys all pages.
+        /// \note   All regions handed out become invalid.
+        ///
+        ///////////////////////////////////////////////////////////
+        void destroy();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       load
+        /// \brief    Packs a PNG image from a relative or absolute path.
+        /// \param    path Absolute or relative path to the image
+        /// \returns  the region of the image or an invalid one.
+        ///
+        ///////////////////////////////////////////////////////////
+        TextureRegion load(const char *path);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       loadFromMemory
+        /// \brief    Packs a PNG image stored in memory.
+        /// \param    bytes PNG image as raw byte data
+        /// \param    size Size of the given data array
+        /// \returns  the region of the image or an invalid one.
+        ///
+        ///////////////////////////////////////////////////////////
+        TextureRegion loadFromMemory(const QUInt8 *bytes, QUInt32 size);
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       add
+        /// \brief    Packs raw RGBA pixels.
+        /// \param    pixels Tightly packed RGBA8 pixels
+        /// \param    width Width of the image, in pixels
+        /// \param    height Height of the image, in pixels
+        /// \returns  the region of the image or an invalid one.
+        ///
+        ///////////////////////////////////////////////////////////
+        TextureRegion add(const QUInt8 *pixels, QUInt32 width, QUInt32 height);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       pageCount -> const
+        /// \brief    Retrieves the amount of pages created so far.
+        /// \returns  the amount of textures of this atlas.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUInt32 pageCount() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       page -> const
+        /// \brief    Retrieves the texture of the given page.
+        /// \param    index Index of the page
+        /// \returns  the RGBA texture of the page.
+        ///
+        ///////////////////////////////////////////////////////////
+        const Texture &page(QUInt32 index) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       pageSize -> static
+        /// \brief    Retrieves the width and height of each page.
+        /// \returns  the dimension of the pages, in pixels.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QUInt32 pageSize();
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     addPage
+        /// \brief  Creates a new, empty page.
+        ///
+        ///////////////////////////////////////////////////////////
+        void addPage();
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        std::vector<Texture> m_Pages;           ///< Page textures
+        std::vector<Atlas<2048> > m_Packers;    ///< Space of each page
+        std::vector<QUInt8> m_Staging;          ///< Extruded image
+        InterpolationMode m_Filter;             ///< Filter of the pages
+        QUInt32 m_Padding;                      ///< Extruded border
+
+    };
+}
+
+
+#endif  // __Q2D_TEXTUREATLAS_HPP__
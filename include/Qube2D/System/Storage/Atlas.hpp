@@ -48,6 +48,8 @@
 ///////////////////////////////////////////////////////////
 #include <Qube2D/System/Structs/Rect.hpp>
 #include <algorithm>
+#include <limits>
+#include <vector>
 #include <utility>
 #include <iostream>
 
@@ -74,6 +76,7 @@ namespace Qube2D
         ///
         ///////////////////////////////////////////////////////////
         Atlas()
+            : m_Dirty(false)
         {
             m_Free.push_back(RectI(0, 0, _s, _s));
         }
@@ -88,6 +91,9 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         inline RectI find(QInt32 width, QInt32 height)
         {
+            if (m_Dirty)
+                rebuild();
+
             RectI fit = score(width, height);
             if (!fit.isValid())
                 return fit;
@@ -97,6 +103,55 @@ namespace Qube2D
             return fit;
         }
 
+        ///////////////////////////////////////////////////////////
+        /// \fn     release
+        /// \brief  Returns a rectangle returned by find to the atlas.
+        /// \param  node Rectangle to free, exactly as returned
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void release(const RectI &node)
+        {
+            for (auto it = m_Used.begin(); it != m_Used.end(); ++it)
+            {
+                if (it->x() == node.x() && it->y() == node.y() &&
+                    it->width() == node.width() && it->height() == node.height())
+                {
+                    m_Used.erase(it);
+                    break;
+                }
+            }
+
+            // Free rectangles are maximal and overlap each other,
+            // thus they are rebuilt once the next rectangle is wanted
+            m_Dirty = true;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     claim
+        /// \brief  Marks a rectangle as used, e.g. when restoring
+        ///         a previously packed atlas.
+        /// \param  node Rectangle to mark
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void claim(const RectI &node)
+        {
+            m_Used.push_back(node);
+            m_Dirty = true;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     reset
+        /// \brief  Frees all rectangles of the atlas at once.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void reset()
+        {
+            m_Used.clear();
+            m_Free.clear();
+            m_Free.push_back(RectI(0, 0, _s, _s));
+            m_Dirty = false;
+        }
+
 
     private:
 
@@ -110,35 +165,24 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         inline bool contains(const RectI &r1, const RectI &r2)
         {
-            int x1 = r1.x(), x2 = r2.x();
-            int y1 = r1.y(), y2 = r2.y();
-            int w1 = r1.width(), w2 = r2.width();
-            int h1 = r1.height(), h2 = r2.height();
-
-            // Bounds check
-            if (x2 < x1 || y2 < y1)
-                return false;
-
-            int ox = w1 + x1;
-            int ow = w2 + x2;
-            int oy = h1 + y1;
-            int oh = h2 + y2;
-
-            // Overflow check
-            if (ow <= x2)
-                if (ox >= x1 || ow > ox)
-                    return false;
-            else
-                if (ox >= x1 && ow > ox)
-                    return false;
-            if (oh <= y2)
-                if (oy >= y1 || oh > oy)
-                    return false;
-            else
-                if (oy >= y1 && oh > oy)
-                    return false;
+            return r2.x() >= r1.x() && r2.y() >= r1.y() &&
+                   r2.x() + r2.width()  <= r1.x() + r1.width() &&
+                   r2.y() + r2.height() <= r1.y() + r1.height();
+        }
 
-            return true;
+        ///////////////////////////////////////////////////////////
+        /// \fn       touches
+        /// \brief    Determines whether a rect overlaps or borders
+        ///           another.
+        /// \param    r1 First rectangle
+        /// \param    r2 Second rectangle
+        /// \returns  TRUE if the edges of 'r1' and 'r2' meet.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline bool touches(const RectI &r1, const RectI &r2)
+        {
+            return r1.x() <= r2.x() + r2.width()  && r2.x() <= r1.x() + r1.width() &&
+                   r1.y() <= r2.y() + r2.height() && r2.y() <= r1.y() + r1.height();
         }
 
         ///////////////////////////////////////////////////////////
@@ -149,25 +193,56 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         inline void place(const RectI &node)
         {
-            // Inserts a rectangle in the free region
-            QUInt32 rectsToProcess = m_Free.size();
+            carve(node);
+            m_Used.push_back(node);
+        }
 
-            for (QUInt32 i = 0; i < rectsToProcess;)
+        ///////////////////////////////////////////////////////////
+        /// \fn     carve
+        /// \brief  Removes a rectangle from the free regions.
+        /// \param  node Rectangle that is in use
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void carve(const RectI &node)
+        {
+            // Replaces every free rectangle the node intersects by its
+            // remainders; the order of the free rectangles is irrelevant
+            m_New.clear();
+            m_Touching.clear();
+            for (QUInt32 i = 0; i < m_Free.size();)
             {
-                if (split(m_Free.at(i), node))
+                if (split(m_Free[i], node))
                 {
-                    m_Free.erase(m_Free.begin() + i);
-                    --rectsToProcess;
+                    m_Free[i] = m_Free.back();
+                    m_Free.pop_back();
                 }
                 else
                 {
+                    if (touches(m_Free[i], node))
+                        m_Touching.push_back(i);
+
                     ++i;
                 }
             }
 
-            // Reorder the list
-            sort();
-            m_Used.push_back(node);
+            // Only the remainders can be redundant
+            prune();
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     rebuild
+        /// \brief  Derives the free regions from the used ones.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void rebuild()
+        {
+            m_Free.clear();
+            m_Free.push_back(RectI(0, 0, _s, _s));
+
+            for (auto it = m_Used.begin(); it != m_Used.end(); ++it)
+                carve(*it);
+
+            m_Dirty = false;
         }
 
         ///////////////////////////////////////////////////////////
@@ -223,7 +298,7 @@ namespace Qube2D
         /// \returns  TRUE if 'free' could be split by 'used'.
         ///
         ///////////////////////////////////////////////////////////
-        inline bool split(const RectI &free, const RectI &used)
+        inline bool split(RectI free, const RectI &used)
         {
             // Do rectangles even intersect?
             if (used.x() >= free.x() + free.width()  || used.x() + used.width()  <= free.x() ||
@@ -237,14 +312,14 @@ namespace Qube2D
                 {
                     RectI node = free;
                     node.setHeight(used.y() - free.y());
-                    m_Free.push_back(node);
+                    m_New.push_back(node);
                 }
                 if (used.y() + used.height() < free.y() + free.height())
                 {
                     RectI node = free;
                     node.setY(used.y() + used.height());
                     node.setHeight((free.y() + free.height()) - node.y());
-                    m_Free.push_back(node);
+                    m_New.push_back(node);
                 }
             }
 
@@ -255,14 +330,14 @@ namespace Qube2D
                 {
                     RectI node = free;
                     node.setWidth(used.x() - free.x());
-                    m_Free.push_back(node);
+                    m_New.push_back(node);
                 }
                 if (used.x() + used.width() < free.x() + free.width())
                 {
                     RectI node = free;
                     node.setX(used.x() + used.width());
                     node.setWidth((free.x() + free.width()) - node.x());
-                    m_Free.push_back(node);
+                    m_New.push_back(node);
                 }
             }
 
@@ -271,29 +346,48 @@ namespace Qube2D
         }
 
         ///////////////////////////////////////////////////////////
-        /// \fn     sort
-        /// \brief  Reorders the free rectangles to improve speed.
+        /// \fn     prune
+        /// \brief  Adds the remainders of a split to the free
+        ///         rectangles, leaving out redundant ones.
+        ///
+        /// The remaining free rectangles never contain each other
+        /// and a remainder lies within a removed free rectangle,
+        /// thus can never contain one of them. A remainder ends
+        /// at an edge of the used rectangle; a free rectangle that
+        /// contains it but does not intersect the used one has to
+        /// end at the same edge. Only the free rectangles touching
+        /// the used one are thus tested, instead of all of them.
         ///
         ///////////////////////////////////////////////////////////
-        inline void sort()
+        inline void prune()
         {
-            // Removes redundant rectangles
-            for (QUInt32 i = 0; i < m_Free.size(); i++)
+            QUInt32 previous = m_Free.size();
+            for (auto it = m_New.begin(); it != m_New.end(); ++it)
             {
-                for (QUInt32 j = i+1; j < m_Free.size(); j++)
+                bool redundant = false;
+                for (QUInt32 i = 0; i < m_Touching.size() && !redundant; i++)
+                    redundant = contains(m_Free[m_Touching[i]], *it);
+
+                // Remainders may contain each other
+                for (QUInt32 i = previous; i < m_Free.size() && !redundant;)
                 {
-                    if (contains(m_Free.at(i), m_Free.at(j)))
+                    if (contains(m_Free[i], *it))
                     {
-                        m_Free.erase(m_Free.begin() + i);
-                        --i;
-                        break;
+                        redundant = true;
                     }
-                    if (contains(m_Free.at(j), m_Free.at(i)))
+                    else if (contains(*it, m_Free[i]))
                     {
-                        m_Free.erase(m_Free.begin() + j);
-                        --j;
+                        m_Free[i] = m_Free.back();
+                        m_Free.pop_back();
+                    }
+                    else
+                    {
+                        ++i;
                     }
                 }
+
+                if (!redundant)
+                    m_Free.push_back(*it);
             }
         }
 
@@ -304,6 +398,9 @@ namespace Qube2D
         ///////////////////////////////////////////////////////////
         std::vector<RectI> m_Used;      ///< Used rectangles
         std::vector<RectI> m_Free;      ///< Free rectangles
+        std::vector<RectI> m_New;       ///< Remainders of the last split
+        std::vector<QUInt32> m_Touching;    ///< Free rects bordering it
+        bool m_Dirty;                   ///< Free rectangles outdated?
 
     };
 }
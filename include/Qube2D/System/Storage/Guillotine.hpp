@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+#ifndef __Q2D_GUILLOTINE_HPP__
+#define __Q2D_GUILLOTINE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/System/Structs/Rect.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    Guillotine.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \class   Guillotine
+    /// \brief   Packs small textures into a bigger one.
+    ///
+    /// Keeps disjoint free rectangles and cuts the best fitting
+    /// one in two after each placement, along the axis with the
+    /// shorter leftover. Neither splits nor lookups have to
+    /// compare free rectangles with each other, which makes it
+    /// faster than Qube2D::Atlas at a slightly worse occupancy.
+    ///
+    ///////////////////////////////////////////////////////////
+    template <QUInt32 _s>
+    class Q2D_API Guillotine
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       Default constructor
+        /// \brief    Creates a new free rectangle of size _s*_s.
+        ///
+        ///////////////////////////////////////////////////////////
+        Guillotine()
+        {
+            m_Free.push_back(RectI(0, 0, _s, _s));
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       find
+        /// \brief    Finds an unused rectangle in the texture.
+        /// \param    width Width of the rectangle to find
+        /// \param    height Height of the rectangle to find
+        /// \returns  the unused rectangle or an invalid, if failed.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline RectI find(QInt32 width, QInt32 height)
+        {
+            QInt64 bestArea = std::numeric_limits<QInt64>::max();
+            QInt32 bestSide = std::numeric_limits<int>::max();
+            QInt32 bestIndex = -1;
+
+            // Gathers free-space via "best area fit"
+            for (QUInt32 i = 0; i < m_Free.size(); i++)
+            {
+                const RectI &free = m_Free[i];
+                if (free.width() < width || free.height() < height)
+                    continue;
+
+                QInt64 area = QInt64(free.width()) * free.height() - QInt64(width) * height;
+                QInt32 side = std::min(free.width() - width, free.height() - height);
+                if (area < bestArea || (area == bestArea && side < bestSide))
+                {
+                    bestArea = area;
+                    bestSide = side;
+                    bestIndex = static_cast<QInt32>(i);
+                }
+            }
+
+            if (bestIndex < 0)
+                return RectI(0, 0, 0, 0);
+
+            RectI rect(m_Free[bestIndex].x(), m_Free[bestIndex].y(), width, height);
+            split(bestIndex, rect);
+            return rect;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     reset
+        /// \brief  Frees all rectangles of the atlas at once.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void reset()
+        {
+            m_Free.clear();
+            m_Free.push_back(RectI(0, 0, _s, _s));
+        }
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     split
+        /// \brief  Replaces a free rectangle by the two parts that
+        ///         are left beside and below the placed one.
+        /// \param  index Index of the free rectangle
+        /// \param  rect Rectangle placed at its top-left corner
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void split(QInt32 index, const RectI &rect)
+        {
+            RectI free = m_Free[index];
+            m_Free[index] = m_Free.back();
+            m_Free.pop_back();
+
+            // The longer leftover keeps the full length of the free one
+            QInt32 right = free.width() - rect.width();
+            QInt32 bottom = free.height() - rect.height();
+            bool horizontal = right <= bottom;
+
+            RectI below(free.x(), free.y() + rect.height(),
+                        horizontal ? free.width() : rect.width(), bottom);
+            RectI beside(free.x() + rect.width(), free.y(),
+                         right, horizontal ? rect.height() : free.height());
+
+            if (below.width() > 0 && below.height() > 0)
+                m_Free.push_back(below);
+            if (beside.width() > 0 && beside.height() > 0)
+                m_Free.push_back(beside);
+        }
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        std::vector<RectI> m_Free;      ///< Disjoint free rectangles
+
+    };
+}
+
+
+#endif  // __Q2D_GUILLOTINE_HPP__
@@ -0,0 +1,236 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_SKYLINE_HPP__
+#define __Q2D_SKYLINE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/System/Structs/Rect.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    Skyline.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \class   Skyline
+    /// \brief   Packs small textures into a bigger one.
+    ///
+    /// Tracks the upper contour of all placed rectangles and
+    /// places new ones at the lowest position, "bottom-left".
+    /// Packs less tightly than Qube2D::Atlas, but only needs
+    /// time linear in the amount of contour segments.
+    ///
+    ///////////////////////////////////////////////////////////
+    template <QUInt32 _s>
+    class Q2D_API Skyline
+    {
+
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       Default constructor
+        /// \brief    Creates a flat contour of width _s.
+        ///
+        ///////////////////////////////////////////////////////////
+        Skyline()
+        {
+            m_Nodes.push_back({ 0, 0, static_cast<QInt32>(_s) });
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       find
+        /// \brief    Finds an unused rectangle in the texture.
+        /// \param    width Width of the rectangle to find
+        /// \param    height Height of the rectangle to find
+        /// \returns  the unused rectangle or an invalid, if failed.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline RectI find(QInt32 width, QInt32 height)
+        {
+            QInt32 bestBottom = std::numeric_limits<int>::max();
+            QInt32 bestWidth = std::numeric_limits<int>::max();
+            QInt32 bestIndex = -1;
+            QInt32 bestY = 0;
+
+            // Chooses the lowest position, preferring narrow segments
+            for (QUInt32 i = 0; i < m_Nodes.size(); i++)
+            {
+                QInt32 y;
+                if (!fit(i, width, height, y))
+                    continue;
+
+                if (y + height < bestBottom ||
+                   (y + height == bestBottom && m_Nodes[i].width < bestWidth))
+                {
+                    bestBottom = y + height;
+                    bestWidth = m_Nodes[i].width;
+                    bestIndex = static_cast<QInt32>(i);
+                    bestY = y;
+                }
+            }
+
+            if (bestIndex < 0)
+                return RectI(0, 0, 0, 0);
+
+            RectI rect(m_Nodes[bestIndex].x, bestY, width, height);
+            place(bestIndex, rect);
+            return rect;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     reset
+        /// \brief  Frees all rectangles of the atlas at once.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void reset()
+        {
+            m_Nodes.clear();
+            m_Nodes.push_back({ 0, 0, static_cast<QInt32>(_s) });
+        }
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \struct  Node
+        /// \brief   Horizontal segment of the contour.
+        ///
+        ///////////////////////////////////////////////////////////
+        struct Node
+        {
+            QInt32 x;       ///< Left edge of the segment
+            QInt32 y;       ///< Height of the contour
+            QInt32 width;   ///< Length of the segment
+        };
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn       fit
+        /// \brief    Determines where a rectangle starting at the
+        ///           given segment would rest on the contour.
+        /// \param    index Index of the leftmost segment
+        /// \param    width Width of the rectangle
+        /// \param    height Height of the rectangle
+        /// \param    (out) y Top edge of the rectangle
+        /// \returns  TRUE if the rectangle fits into the texture.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline bool fit(QUInt32 index, QInt32 width, QInt32 height, QInt32 &y) const
+        {
+            QInt32 x = m_Nodes[index].x;
+            if (x + width > static_cast<QInt32>(_s))
+                return false;
+
+            // Rests on the highest segment beneath the rectangle
+            QInt32 left = width;
+            y = 0;
+            for (QUInt32 i = index; left > 0; i++)
+            {
+                y = std::max(y, m_Nodes[i].y);
+                if (y + height > static_cast<QInt32>(_s))
+                    return false;
+
+                left -= m_Nodes[i].width;
+            }
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     place
+        /// \brief  Raises the contour beneath the rectangle.
+        /// \param  index Index of the leftmost segment
+        /// \param  rect Rectangle to place
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void place(QInt32 index, const RectI &rect)
+        {
+            Node node = { rect.x(), rect.y() + rect.height(), rect.width() };
+            m_Nodes.insert(m_Nodes.begin() + index, node);
+
+            // Shrinks or removes the segments covered by the new one
+            QInt32 right = node.x + node.width;
+            for (QUInt32 i = index + 1; i < m_Nodes.size();)
+            {
+                Node &next = m_Nodes[i];
+                if (next.x >= right)
+                    break;
+
+                QInt32 overlap = right - next.x;
+                if (overlap >= next.width)
+                {
+                    m_Nodes.erase(m_Nodes.begin() + i);
+                    continue;
+                }
+
+                next.x += overlap;
+                next.width -= overlap;
+                break;
+            }
+
+            // Merges neighbouring segments of the same height
+            for (QUInt32 i = 0; i + 1 < m_Nodes.size();)
+            {
+                if (m_Nodes[i].y == m_Nodes[i+1].y)
+                {
+                    m_Nodes[i].width += m_Nodes[i+1].width;
+                    m_Nodes.erase(m_Nodes.begin() + i + 1);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+        }
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        std::vector<Node> m_Nodes;      ///< Contour, left to right
+
+    };
+}
+
+
+#endif  // __Q2D_SKYLINE_HPP__
@@ -0,0 +1,162 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __Q2D_TRANSFORM_HPP__
+#define __Q2D_TRANSFORM_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Config.hpp>
+#include <Qube2D/System/Structs/Rect.hpp>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    Transform.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \struct  Transform
+    /// \brief   Defines a 2D affine transformation (3x2 matrix).
+    ///
+    /// Maps a point by x' = a*x + c*y + tx, y' = b*x + d*y + ty.
+    /// Replaces the 4x4 matrices for the purely 2D transforms
+    /// of Qube2D objects and only expands to a 4x4 matrix when
+    /// it is forwarded to a shader.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct Transform
+    {
+        float a;    ///< X-axis, x component
+        float b;    ///< X-axis, y component
+        float c;    ///< Y-axis, x component
+        float d;    ///< Y-axis, y component
+        float tx;   ///< X-translation
+        float ty;   ///< Y-translation
+
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     setIdentity -> inline
+        /// \brief  Resets the transform to the identity.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void setIdentity()
+        {
+            a = 1.f; b = 0.f;
+            c = 0.f; d = 1.f;
+            tx = 0.f; ty = 0.f;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     map -> inline
+        /// \brief  Transforms the point (x, y).
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void map(float x, float y, float &outX, float &outY) const
+        {
+            outX = a * x + c * y + tx;
+            outY = b * x + d * y + ty;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     mapRect -> inline
+        /// \brief  Retrieves the axis-aligned bounds of the
+        ///         transformed rectangle.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline RectF mapRect(const RectF &rect) const
+        {
+            float hw = rect.width() * 0.5f;
+            float hh = rect.height() * 0.5f;
+            float cx, cy;
+            map(rect.x() + hw, rect.y() + hh, cx, cy);
+
+            // Extents of the mapped box; sign-free for flipped rects
+            if (hw < 0.f) hw = -hw;
+            if (hh < 0.f) hh = -hh;
+            float ex = (a < 0.f ? -a : a) * hw + (c < 0.f ? -c : c) * hh;
+            float ey = (b < 0.f ? -b : b) * hw + (d < 0.f ? -d : d) * hh;
+            return RectF(cx - ex, cy - ey, ex * 2.f, ey * 2.f);
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     translated -> inline
+        /// \brief  Retrieves this transform moved by (x, y).
+        ///
+        ///////////////////////////////////////////////////////////
+        inline Transform translated(float x, float y) const
+        {
+            Transform t = *this;
+            t.tx += x;
+            t.ty += y;
+            return t;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     Multiplication operator -> inline
+        /// \brief  Concatenates; 'other' is applied first.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline Transform operator *(const Transform &other) const
+        {
+            Transform t;
+            t.a  = a * other.a  + c * other.b;
+            t.b  = b * other.a  + d * other.b;
+            t.c  = a * other.c  + c * other.d;
+            t.d  = b * other.c  + d * other.d;
+            t.tx = a * other.tx + c * other.ty + tx;
+            t.ty = b * other.tx + d * other.ty + ty;
+            return t;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// \fn     toMatrix -> inline
+        /// \brief  Expands to a column-major 4x4 matrix.
+        /// \param  m Receives 16 floats, e.g. for glUniformMatrix4fv
+        ///
+        ///////////////////////////////////////////////////////////
+        inline void toMatrix(float *m) const
+        {
+            m[0]  = a;   m[1]  = b;   m[2]  = 0.f; m[3]  = 0.f;
+            m[4]  = c;   m[5]  = d;   m[6]  = 0.f; m[7]  = 0.f;
+            m[8]  = 0.f; m[9]  = 0.f; m[10] = 1.f; m[11] = 0.f;
+            m[12] = tx;  m[13] = ty;  m[14] = 0.f; m[15] = 1.f;
+        }
+    };
+}
+
+
+#endif  // __Q2D_TRANSFORM_HPP__
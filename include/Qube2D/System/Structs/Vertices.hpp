@@ -288,6 +288,62 @@ namespace Qube2D
         TextureVertex v2;   ///< Bottom-right
         TextureVertex v3;   ///< Bottom-left
     };
+
+    ///////////////////////////////////////////////////////////
+    /// \file    Vertices.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \struct  SpriteInstance
+    /// \brief   Defines the per-instance data of a sprite.
+    ///
+    /// Instanced sprites are a unit quad that is moved,
+    /// scaled and rotated in the vertex shader. All values
+    /// fit into 60 bytes; the opacity is baked into the alpha
+    /// of each corner color.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct SpriteInstance
+    {
+        float x;            ///< X-position of the top-left corner
+        float y;            ///< Y-position of the top-left corner
+        float w;            ///< Width, multiplied by the scale
+        float h;            ///< Height, multiplied by the scale
+        float ox;           ///< X-origin of the rotation
+        float oy;           ///< Y-origin of the rotation
+        float angle;        ///< Rotation angle in radians
+        float u0;           ///< Left texture coordinate
+        float v0;           ///< Top texture coordinate
+        float u1;           ///< Right texture coordinate
+        float v1;           ///< Bottom texture coordinate
+        unsigned char rgba[4][4];   ///< Corner tints, clockwise from top-left
+    };
+
+    ///////////////////////////////////////////////////////////
+    /// \file    Vertices.hpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \struct  TextVertex
+    /// \brief   Defines one batched glyph vertex.
+    ///
+    /// Carries the color and distance field thresholds of its
+    /// text pass, so that texts of different styles can share
+    /// a draw call. All values fit into 32 bytes.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct TextVertex
+    {
+        float x;            ///< Transformed x-position
+        float y;            ///< Transformed y-position
+        float u;            ///< Horizontal texture coordinate
+        float v;            ///< Vertical texture coordinate
+        unsigned char r;    ///< Red color component
+        unsigned char g;    ///< Green color component
+        unsigned char b;    ///< Blue color component
+        unsigned char a;    ///< Alpha component, including opacity
+        float edge;         ///< Outer distance field edge or 0
+        float inner;        ///< Inner distance field edge or 0
+        float softness;     ///< Additional edge smoothing
+    };
 }
 
 
@@ -165,6 +165,38 @@ namespace Qube2D
         return m_Manager->folderFiles(folder, extension, count);
     }
 
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      mapFile -> static
+    ///
+    ///////////////////////////////////////////////////////////
+    const QUInt8 *Assets::mapFile(const char *path, QUInt32 *size)
+    {
+        assert(path);
+
+        std::string filePath = path;
+        if (isRelative(path))
+            filePath = makePath(path);
+
+        const QUInt8 *data = m_Manager->mapFile(filePath.c_str(), size);
+        if (data == NULL)
+            Q2DError(Q2D_ASSETS_ERROR_5, filePath.c_str());
+
+        return data;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      unmapFile -> static
+    ///
+    ///////////////////////////////////////////////////////////
+    void Assets::unmapFile(const QUInt8 *data, QUInt32 size)
+    {
+        m_Manager->unmapFile(data, size);
+    }
+
 
     ///////////////////////////////////////////////////////////
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
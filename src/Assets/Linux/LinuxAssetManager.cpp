@@ -41,6 +41,9 @@
 #include <vector>
 #include <unistd.h>
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 
 namespace Qube2D
@@ -162,4 +165,50 @@ namespace Qube2D
         *count = fileVec.size();
         return files;
     }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      mapFile
+    ///
+    //////////////////////////////////////////////////////////
+    const QUInt8 *LinuxAssetManager::mapFile(const char *path, QUInt32 *size) const
+    {
+        assert(path);
+        assert(size);
+
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+            return NULL;
+
+        // Empty files can not be mapped
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0)
+        {
+            close(fd);
+            return NULL;
+        }
+
+        // The mapping remains valid after closing the descriptor
+        void *data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (data == MAP_FAILED)
+            return NULL;
+
+        *size = static_cast<QUInt32>(info.st_size);
+        return static_cast<const QUInt8 *>(data);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      unmapFile
+    ///
+    //////////////////////////////////////////////////////////
+    void LinuxAssetManager::unmapFile(const QUInt8 *data, QUInt32 size) const
+    {
+        if (data != NULL)
+            munmap(const_cast<QUInt8 *>(data), size);
+    }
 }
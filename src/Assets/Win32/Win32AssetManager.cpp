@@ -159,4 +159,58 @@ namespace Qube2D
         *count = foundFiles.size();
         return files;
     }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      mapFile
+    ///
+    ///////////////////////////////////////////////////////////
+    const QUInt8 *Win32AssetManager::mapFile(const char *path, QUInt32 *size) const
+    {
+        assert(path);
+        assert(size);
+
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+        if (file == INVALID_HANDLE_VALUE)
+            return NULL;
+
+        // Empty files can not be mapped
+        DWORD fileSize = GetFileSize(file, NULL);
+        if (fileSize == 0 || fileSize == INVALID_FILE_SIZE)
+        {
+            CloseHandle(file);
+            return NULL;
+        }
+
+        // The view remains valid after closing both handles
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        CloseHandle(file);
+
+        if (mapping == NULL)
+            return NULL;
+
+        void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+
+        if (data == NULL)
+            return NULL;
+
+        *size = static_cast<QUInt32>(fileSize);
+        return static_cast<const QUInt8 *>(data);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      unmapFile
+    ///
+    ///////////////////////////////////////////////////////////
+    void Win32AssetManager::unmapFile(const QUInt8 *data, QUInt32) const
+    {
+        if (data != NULL)
+            UnmapViewOfFile(data);
+    }
 }
@@ -53,7 +53,9 @@ namespace Qube2D
           Object(),
           m_ElapsedTimeA(0.0),
           m_CurrentFrame(0),
-          m_FrameCount(0)
+          m_FrameCount(0),
+          m_IsAnimating(false),
+          m_IsHalting(false)
     {
     }
 
@@ -199,6 +201,8 @@ namespace Qube2D
         m_Vertices.v1.uv(rel_w, rel_y);
         m_Vertices.v2.uv(rel_w, rel_h);
         m_Vertices.v3.uv(rel_x, rel_h);
+
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -273,4 +277,15 @@ namespace Qube2D
         if (!m_IsHalting)
             ISprite::render();
     }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      isVisible
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Animation::isVisible() const
+    {
+        return !m_IsHalting && ISprite::isVisible();
+    }
 }
@@ -182,6 +182,8 @@ namespace Qube2D
         m_Vertices.v1.uv(m_RepeatCountX, 0.f);
         m_Vertices.v2.uv(m_RepeatCountX, m_RepeatCountY);
         m_Vertices.v3.uv(0.f, m_RepeatCountY);
+
+        boundsChanged();
     }
 
 
@@ -0,0 +1,259 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Debug/Debug.hpp>
+#include <Qube2D/Graphics/PackedAtlas.hpp>
+#include <Qube2D/Graphics/System/GraphicsErrors.hpp>
+#include <Qube2D/Assets/Assets.hpp>
+#include <algorithm>
+#include <cstring>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    PackedAtlas::PackedAtlas()
+        : Uncopyable(),
+          m_Data(NULL),
+          m_Size(0),
+          m_Header(NULL),
+          m_Entries(NULL),
+          m_Names(NULL)
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      open
+    ///
+    ///////////////////////////////////////////////////////////
+    bool PackedAtlas::open(const char *path, InterpolationMode filter)
+    {
+        close();
+
+        m_Data = Assets::mapFile(path, &m_Size);
+        if (m_Data == NULL)
+            return false;
+
+        m_Header = reinterpret_cast<const AtlasFileHeader *>(m_Data);
+        if (!validate())
+        {
+            Q2DError(Q2D_ATLAS_ERROR_2, path);
+            close();
+            return false;
+        }
+
+        m_Entries = reinterpret_cast<const AtlasFileEntry *>(m_Data + m_Header->entryOffset);
+        m_Names = reinterpret_cast<const char *>(m_Data + m_Header->nameOffset);
+
+
+        // Decodes the pages; the images themselves need no work
+        const AtlasFilePage *pages =
+                reinterpret_cast<const AtlasFilePage *>(m_Data + m_Header->pageOffset);
+
+        m_Pages.resize(m_Header->pageCount);
+        for (QUInt32 i = 0; i < m_Header->pageCount; i++)
+        {
+            Texture &texture = m_Pages[i];
+            if (!texture.createFromMemory(m_Data + pages[i].offset, pages[i].size))
+            {
+                close();
+                return false;
+            }
+
+            texture.setHorizontalWrap(WrapMode::ClampToEdge);
+            texture.setVerticalWrap(WrapMode::ClampToEdge);
+            texture.setMinFilter(filter);
+            texture.setMagFilter(filter);
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      close
+    ///
+    ///////////////////////////////////////////////////////////
+    void PackedAtlas::close()
+    {
+        for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
+            it->destroy();
+
+        if (m_Data != NULL)
+            Assets::unmapFile(m_Data, m_Size);
+
+        m_Pages.clear();
+        m_Data = NULL;
+        m_Size = 0;
+        m_Header = NULL;
+        m_Entries = NULL;
+        m_Names = NULL;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      find -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    TextureRegion PackedAtlas::find(const char *name) const
+    {
+        assert(name);
+
+        TextureRegion region;
+        if (m_Entries == NULL)
+            return region;
+
+        // Binary-searches the first entry with the same hash
+        QUInt32 hash = atlasHash(name);
+        const AtlasFileEntry *end = m_Entries + m_Header->entryCount;
+        const AtlasFileEntry *it = std::lower_bound(m_Entries, end, hash,
+                [](const AtlasFileEntry &e, QUInt32 h) { return e.hash < h; });
+
+        // Compares the names of all entries sharing the hash
+        for (; it != end && it->hash == hash; ++it)
+        {
+            if (strcmp(m_Names + it->name, name) != 0)
+                continue;
+
+            region.page = m_Pages[it->page];
+            region.area = RectF(it->x, it->y, it->width, it->height);
+            break;
+        }
+
+        return region;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      imageCount -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 PackedAtlas::imageCount() const
+    {
+        return m_Header ? m_Header->entryCount : 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      pageCount -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 PackedAtlas::pageCount() const
+    {
+        return m_Pages.size();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      page -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    const Texture &PackedAtlas::page(QUInt32 index) const
+    {
+        return m_Pages.at(index);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      validate -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    bool PackedAtlas::validate() const
+    {
+        const AtlasFileHeader &h = *m_Header;
+        QUInt64 size = m_Size;
+
+        if (size < sizeof(AtlasFileHeader) ||
+            h.magic != Q2D_ATLAS_FILE_MAGIC ||
+            h.version != Q2D_ATLAS_FILE_VERSION)
+            return false;
+
+        // The tables must be aligned and lie within the file
+        if (h.pageOffset % 4 != 0 || h.entryOffset % 4 != 0 ||
+            h.pageOffset + QUInt64(h.pageCount) * sizeof(AtlasFilePage) > size ||
+            h.entryOffset + QUInt64(h.entryCount) * sizeof(AtlasFileEntry) > size ||
+            h.nameOffset > size)
+            return false;
+
+        // The name pool ends where the first page starts
+        const AtlasFilePage *pages =
+                reinterpret_cast<const AtlasFilePage *>(m_Data + h.pageOffset);
+
+        QUInt64 poolEnd = size;
+        for (QUInt32 i = 0; i < h.pageCount; i++)
+        {
+            if (pages[i].offset + QUInt64(pages[i].size) > size)
+                return false;
+
+            poolEnd = std::min(poolEnd, QUInt64(pages[i].offset));
+        }
+
+        // Every name must be terminated within the pool
+        if (poolEnd <= h.nameOffset && h.entryCount != 0)
+            return false;
+        if (h.entryCount != 0 && m_Data[poolEnd - 1] != '\0')
+            return false;
+
+        const AtlasFileEntry *entries =
+                reinterpret_cast<const AtlasFileEntry *>(m_Data + h.entryOffset);
+
+        for (QUInt32 i = 0; i < h.entryCount; i++)
+        {
+            if (entries[i].page >= h.pageCount ||
+                h.nameOffset + QUInt64(entries[i].name) >= poolEnd)
+                return false;
+        }
+
+        return true;
+    }
+}
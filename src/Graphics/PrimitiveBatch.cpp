@@ -0,0 +1,416 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Debug/GLCheck.hpp>
+#include <Qube2D/Graphics/PrimitiveBatch.hpp>
+#include <Qube2D/Graphics/System/Culling.hpp>
+#include <Qube2D/Graphics/System/OpenGL/StreamBuffer.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstring>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define PRIMBATCH_TRIANGLES         0
+    #define PRIMBATCH_LINES             1
+    #define PRIMBATCH_POINTS            2
+    #define PRIMBATCH_TOPOLOGIES        3
+    #define PRIMBATCH_SINGLE_VERTEX     (sizeof(float) * 6)
+    #define PRIMBATCH_OFFSET_BLEND      (const void *)(sizeof(float) * 2)
+    #define PRIMBATCH_BASE_VERTEX(o)    static_cast<GLint>((o) / PRIMBATCH_SINGLE_VERTEX)
+
+    ///////////////////////////////////////////////////////////
+    // Local helpers
+    //
+    ///////////////////////////////////////////////////////////
+    namespace
+    {
+        const GLenum topologyModes[PRIMBATCH_TOPOLOGIES] =
+        {
+            GL_TRIANGLES,
+            GL_LINES,
+            GL_POINTS
+        };
+
+        ///////////////////////////////////////////////////////////
+        /// Determines the list a draw mode is converted into.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline QUInt32 topologyOf(DrawMode mode)
+        {
+            switch (mode)
+            {
+                case DrawMode::Triangles:
+                case DrawMode::TriangleStrip:
+                case DrawMode::TriangleFan:
+                    return PRIMBATCH_TRIANGLES;
+
+                case DrawMode::Lines:
+                case DrawMode::LineStrip:
+                case DrawMode::LineLoop:
+                    return PRIMBATCH_LINES;
+
+                default:
+                    return PRIMBATCH_POINTS;
+            }
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    PrimitiveBatch::PrimitiveBatch()
+        : Uncopyable(),
+          m_Capacity(0),
+          m_Topology(PRIMBATCH_TRIANGLES),
+          m_Program(NULL),
+          m_DrawCalls(0),
+          m_PrimitiveCount(0)
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      create
+    ///
+    ///////////////////////////////////////////////////////////
+    void PrimitiveBatch::create(QUInt32 capacity)
+    {
+        if (capacity == 0)
+            capacity = 1;
+
+        m_Capacity = capacity;
+        m_Vertices.reserve(capacity);
+        m_Indices.reserve(capacity * 2);
+
+
+        // Vertices and indices are both streamed into the shared
+        // ring buffer, which thus is the element buffer as well.
+        m_VertexArray.create();
+        m_VertexArray.bind();
+        StreamBuffer::vertexStream().bind();
+        GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, StreamBuffer::vertexStream().id());
+
+        m_VertexArray.enableAttrib(0);
+        m_VertexArray.enableAttrib(1);
+
+        glCheck(glVertexAttribPointer(
+                    0,
+                    2,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    PRIMBATCH_SINGLE_VERTEX,
+                    NULL));
+
+        glCheck(glVertexAttribPointer(
+                    1,
+                    4,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    PRIMBATCH_SINGLE_VERTEX,
+                    PRIMBATCH_OFFSET_BLEND));
+
+        m_VertexArray.unbind();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      destroy
+    ///
+    ///////////////////////////////////////////////////////////
+    void PrimitiveBatch::destroy()
+    {
+        m_VertexArray.destroy();
+        m_Vertices.clear();
+        m_Indices.clear();
+        m_Capacity = 0;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      begin
+    ///
+    ///////////////////////////////////////////////////////////
+    void PrimitiveBatch::begin()
+    {
+        m_Vertices.clear();
+        m_Indices.clear();
+        m_Program = NULL;
+        m_DrawCalls = 0;
+        m_PrimitiveCount = 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      draw
+    ///
+    ///////////////////////////////////////////////////////////
+    void PrimitiveBatch::draw(const IPrimitive &primitive)
+    {
+        const PolygonVertices &src = primitive.vertices();
+        DrawMode mode = primitive.drawMode();
+        QUInt32 count = static_cast<QUInt32>(src.size());
+
+        if (count == 0 || mode == DrawMode::Patches)
+            return;
+        if (!Culling::isVisible(primitive.bounds()))
+            return;
+
+        // Starts a new run if the program or the topology changes,
+        // which keeps overlapping shapes in submission order, or if
+        // the run is full.
+        QUInt32 topology = topologyOf(mode);
+        ShaderProgram *program = primitive.shaderProgram();
+
+        if (m_Program != program ||
+            m_Topology != topology ||
+            m_Vertices.size() + count > m_Capacity)
+        {
+            flush();
+        }
+
+        m_Program = program;
+        m_Topology = topology;
+
+
+        // Transforms the vertices and bakes in the opacity, which
+        // the shader would otherwise multiply with the alpha.
+        Transform t = primitive.transform().translated(primitive.x(), primitive.y());
+        QFloat opacity = primitive.opacity();
+        std::vector<PrimitiveVertex> &dst = m_Vertices;
+        QUInt32 base = static_cast<QUInt32>(dst.size());
+
+        dst.resize(base + count);
+        for (QUInt32 i = 0; i < count; i++)
+        {
+            PrimitiveVertex &v = dst[base + i];
+            v = src.v[i];
+            t.map(src.v[i].x, src.v[i].y, v.x, v.y);
+            v.a *= opacity;
+        }
+
+        addIndices(mode, base, count);
+        m_PrimitiveCount++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      flush
+    ///
+    ///////////////////////////////////////////////////////////
+    void PrimitiveBatch::flush()
+    {
+        if (m_Program == NULL)
+            return;
+
+        // Vertices are transformed already; only project them
+        float projection[16];
+        m_Projection.toMatrix(projection);
+
+        // Binds all necessary objects
+        m_VertexArray.bind();
+        m_Program->bind();
+
+        glCheck(glUniformMatrix4fv(m_Program->getUniformLocation("uni_mvp"), 1, GL_FALSE, projection));
+        glCheck(glUniform1f(m_Program->getUniformLocation("uni_opacity"), 1.f));
+
+
+        // Reserves the vertices and the indices behind them with a
+        // single map, so that the stream never moves on to another
+        // region between the two and fences it before this draw.
+        StreamBuffer &stream = StreamBuffer::vertexStream();
+        QUInt32 indices = static_cast<QUInt32>(m_Indices.size());
+        QUInt32 vertexSize = static_cast<QUInt32>(m_Vertices.size() * PRIMBATCH_SINGLE_VERTEX);
+        QUInt32 vertexOffset = 0;
+        void *range = NULL;
+
+        if (indices != 0)
+        {
+            range = stream.map(
+                        vertexSize + indices * sizeof(QUInt32),
+                        vertexOffset,
+                        PRIMBATCH_SINGLE_VERTEX);
+        }
+
+        if (range != NULL)
+        {
+            std::memcpy(range, m_Vertices.data(), vertexSize);
+            std::memcpy(static_cast<char *>(range) + vertexSize,
+                        m_Indices.data(),
+                        indices * sizeof(QUInt32));
+            stream.unmap();
+
+            QUInt32 indexOffset = vertexOffset + vertexSize;
+
+            glCheck(glDrawElementsBaseVertex(
+                        topologyModes[m_Topology],
+                        indices,
+                        GL_UNSIGNED_INT,
+                        reinterpret_cast<const void *>(static_cast<std::size_t>(indexOffset)),
+                        PRIMBATCH_BASE_VERTEX(vertexOffset)));
+
+            m_DrawCalls++;
+        }
+
+        m_Vertices.clear();
+        m_Indices.clear();
+        m_Program = NULL;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      end
+    ///
+    ///////////////////////////////////////////////////////////
+    void PrimitiveBatch::end()
+    {
+        flush();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      drawCalls -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 PrimitiveBatch::drawCalls() const
+    {
+        return m_DrawCalls;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      primitiveCount -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 PrimitiveBatch::primitiveCount() const
+    {
+        return m_PrimitiveCount;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      addIndices
+    ///
+    ///////////////////////////////////////////////////////////
+    void PrimitiveBatch::addIndices(DrawMode mode, QUInt32 base, QUInt32 count)
+    {
+        std::vector<QUInt32> &dst = m_Indices;
+
+        switch (mode)
+        {
+            case DrawMode::TriangleFan:
+                for (QUInt32 i = 1; i + 1 < count; i++)
+                {
+                    dst.push_back(base);
+                    dst.push_back(base + i);
+                    dst.push_back(base + i + 1);
+                }
+                break;
+
+            case DrawMode::TriangleStrip:
+                // Swaps every other triangle to keep the winding
+                for (QUInt32 i = 0; i + 2 < count; i++)
+                {
+                    dst.push_back(base + i + (i & 1));
+                    dst.push_back(base + i + 1 - (i & 1));
+                    dst.push_back(base + i + 2);
+                }
+                break;
+
+            case DrawMode::Triangles:
+                for (QUInt32 i = 0; i + 2 < count; i += 3)
+                {
+                    dst.push_back(base + i);
+                    dst.push_back(base + i + 1);
+                    dst.push_back(base + i + 2);
+                }
+                break;
+
+            case DrawMode::LineLoop:
+            case DrawMode::LineStrip:
+                for (QUInt32 i = 0; i + 1 < count; i++)
+                {
+                    dst.push_back(base + i);
+                    dst.push_back(base + i + 1);
+                }
+
+                // Closes the loop
+                if (mode == DrawMode::LineLoop && count > 2)
+                {
+                    dst.push_back(base + count - 1);
+                    dst.push_back(base);
+                }
+                break;
+
+            case DrawMode::Lines:
+                for (QUInt32 i = 0; i + 1 < count; i += 2)
+                {
+                    dst.push_back(base + i);
+                    dst.push_back(base + i + 1);
+                }
+                break;
+
+            default:
+                for (QUInt32 i = 0; i < count; i++)
+                    dst.push_back(base + i);
+                break;
+        }
+    }
+}
@@ -0,0 +1,500 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/RenderQueue.hpp>
+#include <Qube2D/Graphics/Text/Font.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define RENDER_KIND_SPRITE      0
+    #define RENDER_KIND_PRIMITIVE   1
+    #define RENDER_KIND_TEXT        2
+    #define RENDER_KIND_NONE        3
+    #define RENDER_MAX_LAYER        255u
+    #define RENDER_MAX_BAND         0xFFFFu
+    #define RENDER_SHIFT_LAYER      56
+    #define RENDER_SHIFT_BAND       40
+    #define RENDER_SHIFT_SEQUENCE   23
+    #define RENDER_SHIFT_KIND       38
+    #define RENDER_SHIFT_PROGRAM    26
+    #define RENDER_SHIFT_TEXTURE    6
+    #define RENDER_SHIFT_BLEND      2
+    #define RENDER_RADIX_PASSES     8
+    #define RENDER_CELL_SIZE        64.f
+    #define RENDER_MAX_CELLS        256
+    #define RENDER_MIN_TABLE        1024u
+    #define RENDER_CELL_KEY(l,x,y)  ((static_cast<QUInt64>(l) << 56) | (static_cast<QUInt64>(1) << 55) | \
+                                     ((static_cast<QUInt64>(x) & 0x7FFFFFF) << 27) |                    \
+                                     (static_cast<QUInt64>(y) & 0x7FFFFFF))
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       Qube2D_RenderQueue_Probe -> inline
+    /// \brief    Finds the slot of a cell or the empty one it
+    ///           would be inserted at.
+    ///
+    ///////////////////////////////////////////////////////////
+    inline std::size_t Qube2D_RenderQueue_Probe(const std::vector<QUInt64> &keys, QUInt64 key)
+    {
+        std::size_t mask = keys.size() - 1;
+        std::size_t i = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+        while (keys[i] != 0 && keys[i] != key)
+            i = (i + 1) & mask;
+
+        return i;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    RenderQueue::RenderQueue()
+        : Uncopyable(),
+          m_CellCount(0),
+          m_Sequence(0),
+          m_DrawCalls(0),
+          m_StateSorting(true)
+    {
+        std::fill(m_Floors, m_Floors + RENDER_MAX_LAYER + 1, 0u);
+        std::fill(m_Tops, m_Tops + RENDER_MAX_LAYER + 1, 0u);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      create
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::create(QUInt32 capacity, BatchMode mode)
+    {
+        m_SpriteBatch.create(capacity, mode);
+        m_PrimitiveBatch.create();
+        m_TextBatch.create();
+        m_Items.reserve(capacity);
+        m_Swap.reserve(capacity);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      destroy
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::destroy()
+    {
+        m_SpriteBatch.destroy();
+        m_PrimitiveBatch.destroy();
+        m_TextBatch.destroy();
+        m_Items.clear();
+        m_Swap.clear();
+        m_CellKeys.clear();
+        m_CellBands.clear();
+        m_CellCount = 0;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      setStateSorting
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::setStateSorting(QBool enabled)
+    {
+        m_StateSorting = enabled;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      submit
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::submit(const ISprite &sprite, QUInt32 layer)
+    {
+        if (!sprite.isVisible())
+            return;
+
+        push(&sprite,
+             RENDER_KIND_SPRITE,
+             layer,
+             sprite.bounds(),
+             sprite.shaderProgram()->id(),
+             sprite.texture().id(),
+             static_cast<QUInt32>(sprite.blendMode()));
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      submit
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::submit(const IPrimitive &primitive, QUInt32 layer)
+    {
+        push(&primitive,
+             RENDER_KIND_PRIMITIVE,
+             layer,
+             primitive.bounds(),
+             primitive.shaderProgram()->id(),
+             0,
+             0);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      submit
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::submit(Text &text, QUInt32 layer)
+    {
+        if (text.font() == NULL)
+            return;
+
+        // Keys the text by the page its glyphs are packed in
+        text.refresh();
+        push(&text, RENDER_KIND_TEXT, layer, text.bounds(), 0, text.texture().id(), 0);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      sort
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::sort()
+    {
+        QUInt32 count = static_cast<QUInt32>(m_Items.size());
+        if (count < 2)
+            return;
+
+        // Builds the histograms of all eight bytes in one go
+        QUInt32 counts[RENDER_RADIX_PASSES][256];
+        std::memset(counts, 0, sizeof(counts));
+
+        for (QUInt32 i = 0; i < count; i++)
+        {
+            QUInt64 key = m_Items[i].key;
+            for (QUInt32 p = 0; p < RENDER_RADIX_PASSES; p++)
+                counts[p][(key >> (p * 8)) & 0xFF]++;
+        }
+
+
+        // Least significant byte first; each pass is stable,
+        // thus equal keys keep their submission order.
+        m_Swap.resize(count);
+        RenderItem *src = m_Items.data();
+        RenderItem *dst = m_Swap.data();
+
+        for (QUInt32 p = 0; p < RENDER_RADIX_PASSES; p++)
+        {
+            QUInt32 shift = p * 8;
+            QUInt32 *bucket = counts[p];
+
+            // Skips bytes which are equal for all keys, which is
+            // the case for most bytes of a typical frame.
+            if (bucket[(src[0].key >> shift) & 0xFF] == count)
+                continue;
+
+            QUInt32 offset = 0;
+            for (QUInt32 b = 0; b < 256; b++)
+            {
+                QUInt32 amount = bucket[b];
+                bucket[b] = offset;
+                offset += amount;
+            }
+
+            for (QUInt32 i = 0; i < count; i++)
+                dst[bucket[(src[i].key >> shift) & 0xFF]++] = src[i];
+
+            std::swap(src, dst);
+        }
+
+        if (src != m_Items.data())
+            m_Items.swap(m_Swap);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      execute
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::execute()
+    {
+        sort();
+
+        m_DrawCalls = 0;
+        m_SpriteBatch.begin();
+        m_PrimitiveBatch.begin();
+        m_TextBatch.begin();
+
+        // Batches consecutive objects of the same kind; the
+        // batches flush on their own once the state changes.
+        QUInt32 active = RENDER_KIND_NONE;
+        for (std::size_t i = 0; i < m_Items.size(); i++)
+        {
+            const RenderItem &item = m_Items[i];
+            if (item.kind != active)
+            {
+                finishRun(active);
+                active = item.kind;
+            }
+
+            if (item.kind == RENDER_KIND_SPRITE)
+                m_SpriteBatch.draw(*static_cast<const ISprite *>(item.object));
+            else if (item.kind == RENDER_KIND_PRIMITIVE)
+                m_PrimitiveBatch.draw(*static_cast<const IPrimitive *>(item.object));
+            else
+                m_TextBatch.draw(*static_cast<Text *>(const_cast<void *>(item.object)));
+        }
+
+        finishRun(active);
+        m_DrawCalls += m_SpriteBatch.drawCalls();
+        m_DrawCalls += m_PrimitiveBatch.drawCalls();
+        m_DrawCalls += m_TextBatch.drawCalls();
+        clear();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      clear
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::clear()
+    {
+        m_Items.clear();
+        m_Sequence = 0;
+
+        std::fill(m_Floors, m_Floors + RENDER_MAX_LAYER + 1, 0u);
+        std::fill(m_Tops, m_Tops + RENDER_MAX_LAYER + 1, 0u);
+        if (m_CellCount != 0)
+        {
+            std::fill(m_CellKeys.begin(), m_CellKeys.end(), 0u);
+            m_CellCount = 0;
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      size -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 RenderQueue::size() const
+    {
+        return static_cast<QUInt32>(m_Items.size());
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      items -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    const std::vector<RenderItem> &RenderQueue::items() const
+    {
+        return m_Items;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      drawCalls -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 RenderQueue::drawCalls() const
+    {
+        return m_DrawCalls;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      push
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::push(const void *object,
+                           QUInt32 kind,
+                           QUInt32 layer,
+                           const RectF &bounds,
+                           QUInt32 program,
+                           QUInt32 texture,
+                           QUInt32 blend)
+    {
+        RenderItem item;
+        item.object = object;
+        item.kind = kind;
+        layer = std::min(layer, RENDER_MAX_LAYER);
+        item.key = static_cast<QUInt64>(layer) << RENDER_SHIFT_LAYER;
+
+        // Objects are grouped by state within their band; their
+        // state bits are truncated, which merely affects how well
+        // they are grouped. Objects of the last band, which may
+        // overlap, keep their submission order instead.
+        if (!m_StateSorting)
+        {
+            item.key |= static_cast<QUInt64>(m_Sequence) << RENDER_SHIFT_SEQUENCE;
+        }
+        else
+        {
+            QUInt32 band = bandOf(layer, bounds);
+            item.key |= static_cast<QUInt64>(band) << RENDER_SHIFT_BAND;
+
+            if (band < RENDER_MAX_BAND)
+            {
+                item.key |= static_cast<QUInt64>(kind & 0x3) << RENDER_SHIFT_KIND;
+                item.key |= static_cast<QUInt64>(program & 0xFFF) << RENDER_SHIFT_PROGRAM;
+                item.key |= static_cast<QUInt64>(texture & 0xFFFFF) << RENDER_SHIFT_TEXTURE;
+                item.key |= static_cast<QUInt64>(blend & 0xF) << RENDER_SHIFT_BLEND;
+            }
+        }
+
+        m_Items.push_back(item);
+        m_Sequence++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      bandOf
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 RenderQueue::bandOf(QUInt32 layer, const RectF &bounds)
+    {
+        QInt64 x0 = static_cast<QInt64>(std::floor(bounds.x() / RENDER_CELL_SIZE));
+        QInt64 y0 = static_cast<QInt64>(std::floor(bounds.y() / RENDER_CELL_SIZE));
+        QInt64 x1 = static_cast<QInt64>(std::floor((bounds.x() + bounds.width()) / RENDER_CELL_SIZE));
+        QInt64 y1 = static_cast<QInt64>(std::floor((bounds.y() + bounds.height()) / RENDER_CELL_SIZE));
+
+        // Objects spanning many cells, e.g. backgrounds, are put
+        // between all earlier and all later objects of the layer
+        if ((x1 - x0 + 1) * (y1 - y0 + 1) > RENDER_MAX_CELLS)
+        {
+            QUInt32 band = std::min(m_Tops[layer], RENDER_MAX_BAND);
+            m_Floors[layer] = std::min(band + 1, RENDER_MAX_BAND);
+            m_Tops[layer] = m_Floors[layer];
+            return band;
+        }
+
+
+        // Goes above the highest object in any of the cells
+        QUInt32 band = m_Floors[layer];
+        for (QInt64 y = y0; y <= y1; y++)
+            for (QInt64 x = x0; x <= x1; x++)
+                band = std::max(band, cell(RENDER_CELL_KEY(layer, x, y)));
+
+        band = std::min(band, RENDER_MAX_BAND);
+        for (QInt64 y = y0; y <= y1; y++)
+            for (QInt64 x = x0; x <= x1; x++)
+                cell(RENDER_CELL_KEY(layer, x, y)) = std::min(band + 1, RENDER_MAX_BAND);
+
+        m_Tops[layer] = std::max(m_Tops[layer], std::min(band + 1, RENDER_MAX_BAND));
+        return band;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      cell
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 &RenderQueue::cell(QUInt64 key)
+    {
+        // Keeps the table at most half full; re-inserts all cells
+        if ((m_CellCount + 1) * 2 > m_CellKeys.size())
+        {
+            std::vector<QUInt64> keys(std::max<std::size_t>(RENDER_MIN_TABLE, m_CellKeys.size() * 2), 0u);
+            std::vector<QUInt32> bands(keys.size(), 0u);
+            for (std::size_t i = 0; i < m_CellKeys.size(); i++)
+            {
+                if (m_CellKeys[i] == 0)
+                    continue;
+
+                std::size_t slot = Qube2D_RenderQueue_Probe(keys, m_CellKeys[i]);
+                keys[slot] = m_CellKeys[i];
+                bands[slot] = m_CellBands[i];
+            }
+
+            m_CellKeys.swap(keys);
+            m_CellBands.swap(bands);
+        }
+
+        std::size_t slot = Qube2D_RenderQueue_Probe(m_CellKeys, key);
+        if (m_CellKeys[slot] == 0)
+        {
+            m_CellKeys[slot] = key;
+            m_CellBands[slot] = 0;
+            m_CellCount++;
+        }
+
+        return m_CellBands[slot];
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      finishRun
+    ///
+    ///////////////////////////////////////////////////////////
+    void RenderQueue::finishRun(QUInt32 kind)
+    {
+        if (kind == RENDER_KIND_SPRITE)
+            m_SpriteBatch.end();
+        else if (kind == RENDER_KIND_PRIMITIVE)
+            m_PrimitiveBatch.end();
+        else if (kind == RENDER_KIND_TEXT)
+            m_TextBatch.end();
+    }
+}
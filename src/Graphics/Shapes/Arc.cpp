@@ -91,6 +91,8 @@ namespace Qube2D
             x = (c*x) - (s*y);
             y = (s*t) + (c*y);
         }
+
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -66,6 +66,7 @@ namespace Qube2D
         m_Vertices[0].xy(start.x(), start.y());
         m_Vertices[1].xy(end.x(), end.y());
         setOrigin((end.x()-start.x()) / 2, (end.y()-start.y()) / 2);
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -81,6 +81,7 @@ namespace Qube2D
         }
 
         setOrigin(sx / s, sy / s);
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -128,5 +129,6 @@ namespace Qube2D
             v.push_back({ cx + radius*cosf((2*i)*(M_PI/n)), cy + radius*sinf((2*i)*(M_PI/n)) });
 
         setVertices(v);
+        boundsChanged();
     }
 }
@@ -68,6 +68,7 @@ namespace Qube2D
         m_Vertices[2].xy(rect.x() + rect.width(), rect.y() + rect.height());
         m_Vertices[3].xy(rect.x(), rect.y() + rect.height());
         setOrigin(rect.width()/2, rect.height()/2);
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -72,6 +72,7 @@ namespace Qube2D
         m_Vertices[2].xy(c.x(), c.y());
         setOrigin((a.x()+b.x()+c.x())*m,
                   (a.y()+b.y()+c.y())*m);
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -0,0 +1,509 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/SpatialIndex.hpp>
+#include <Qube2D/Graphics/System/Base/IMovable.hpp>
+#include <cmath>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define SPATIAL_CELL_LIMIT      1073741824
+
+
+    ///////////////////////////////////////////////////////////
+    // Local helpers
+    //
+    ///////////////////////////////////////////////////////////
+    namespace
+    {
+        ///////////////////////////////////////////////////////////
+        /// Retrieves the cell containing the coordinate.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline QInt32 cellOf(QFloat v, QFloat inv)
+        {
+            QFloat c = std::floor(v * inv);
+            if (!(c > -SPATIAL_CELL_LIMIT))
+                return -SPATIAL_CELL_LIMIT;
+            if (c > SPATIAL_CELL_LIMIT)
+                return SPATIAL_CELL_LIMIT;
+
+            return static_cast<QInt32>(c);
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// Packs the cell coordinates into a hash key.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline QUInt64 cellKey(QInt32 x, QInt32 y)
+        {
+            return (static_cast<QUInt64>(static_cast<QUInt32>(x)) << 32) |
+                    static_cast<QUInt64>(static_cast<QUInt32>(y));
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// Determines whether the two rectangles overlap.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline QBool overlaps(const RectF &a, const RectF &b)
+        {
+            return a.x() <= b.x() + b.width() && b.x() <= a.x() + a.width() &&
+                   a.y() <= b.y() + b.height() && b.y() <= a.y() + a.height();
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// Determines whether the rectangle contains the point.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline QBool contains(const RectF &r, QFloat x, QFloat y)
+        {
+            return x >= r.x() && x < r.x() + r.width() &&
+                   y >= r.y() && y < r.y() + r.height();
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    SpatialIndex::SpatialIndex(QFloat cellSize)
+        : m_CellSize(cellSize > 1.f ? cellSize : 1.f),
+          m_InvCellSize(1.f / m_CellSize),
+          m_Stamp(0),
+          m_Count(0)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Destructor
+    ///
+    ///////////////////////////////////////////////////////////
+    SpatialIndex::~SpatialIndex()
+    {
+        clear();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      insert
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpatialIndex::insert(ISpatial *object)
+    {
+        if (object->m_SpatialIndex == this)
+            return;
+        if (object->m_SpatialIndex)
+            object->m_SpatialIndex->remove(object);
+
+        // Reuses a removed entry if possible
+        QUInt32 id;
+        if (!m_Free.empty())
+        {
+            id = m_Free.back();
+            m_Free.pop_back();
+        }
+        else
+        {
+            id = static_cast<QUInt32>(m_Entries.size());
+            m_Entries.push_back(SpatialEntry());
+        }
+
+        SpatialEntry &entry = m_Entries[id];
+        entry.object = object;
+        entry.x0 = entry.y0 = 0;
+        entry.x1 = entry.y1 = -1;
+        entry.stamp = m_Stamp;
+        entry.isLarge = false;
+
+        object->m_SpatialIndex = this;
+        object->m_SpatialId = id;
+        object->m_IsQueued = false;
+
+        place(id, object->bounds());
+        m_Count++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      remove
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpatialIndex::remove(ISpatial *object)
+    {
+        if (object->m_SpatialIndex != this)
+            return;
+
+        // Queued ids of removed entries are skipped by update
+        QUInt32 id = object->m_SpatialId;
+        unlink(id);
+        m_Entries[id].object = NULL;
+        m_Free.push_back(id);
+        m_Count--;
+
+        object->m_SpatialIndex = NULL;
+        object->m_IsQueued = false;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      clear
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpatialIndex::clear()
+    {
+        for (std::size_t i = 0; i < m_Entries.size(); i++)
+        {
+            ISpatial *object = m_Entries[i].object;
+            if (object)
+            {
+                object->m_SpatialIndex = NULL;
+                object->m_IsQueued = false;
+            }
+        }
+
+        m_Cells.clear();
+        m_Entries.clear();
+        m_Free.clear();
+        m_Queued.clear();
+        m_Large.clear();
+        m_Count = 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      update
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpatialIndex::update()
+    {
+        for (std::size_t i = 0; i < m_Queued.size(); i++)
+        {
+            QUInt32 id = m_Queued[i];
+            ISpatial *object = m_Entries[id].object;
+            if (!object || !object->m_IsQueued)
+                continue;
+
+            object->m_IsQueued = false;
+            place(id, object->bounds());
+        }
+
+        m_Queued.clear();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      query
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpatialIndex::query(const RectF &area, std::vector<ISpatial *> &result)
+    {
+        update();
+
+        // Restarts the stamps before they wrap around
+        if (++m_Stamp == 0)
+        {
+            for (std::size_t i = 0; i < m_Entries.size(); i++)
+                m_Entries[i].stamp = 0;
+
+            m_Stamp = 1;
+        }
+
+        // Oversized entries are not bucketed
+        for (std::size_t i = 0; i < m_Large.size(); i++)
+        {
+            SpatialEntry &entry = m_Entries[m_Large[i]];
+            if (overlaps(entry.bounds, area))
+                result.push_back(entry.object);
+        }
+
+        QInt32 x0 = cellOf(area.x(), m_InvCellSize);
+        QInt32 y0 = cellOf(area.y(), m_InvCellSize);
+        QInt32 x1 = cellOf(area.x() + area.width(), m_InvCellSize);
+        QInt32 y1 = cellOf(area.y() + area.height(), m_InvCellSize);
+        QUInt64 cells = static_cast<QUInt64>(static_cast<QInt64>(x1) - x0 + 1) *
+                        static_cast<QUInt64>(static_cast<QInt64>(y1) - y0 + 1);
+
+        // Walks the occupied cells if the area covers more of them
+        if (cells > m_Cells.size())
+        {
+            std::unordered_map<QUInt64, std::vector<QUInt32> >::iterator it;
+            for (it = m_Cells.begin(); it != m_Cells.end(); ++it)
+            {
+                for (std::size_t i = 0; i < it->second.size(); i++)
+                {
+                    SpatialEntry &entry = m_Entries[it->second[i]];
+                    if (entry.stamp == m_Stamp)
+                        continue;
+
+                    entry.stamp = m_Stamp;
+                    if (overlaps(entry.bounds, area))
+                        result.push_back(entry.object);
+                }
+            }
+
+            return;
+        }
+
+        for (QInt32 cy = y0; cy <= y1; cy++)
+        {
+            for (QInt32 cx = x0; cx <= x1; cx++)
+            {
+                std::unordered_map<QUInt64, std::vector<QUInt32> >::iterator it;
+                it = m_Cells.find(cellKey(cx, cy));
+                if (it == m_Cells.end())
+                    continue;
+
+                for (std::size_t i = 0; i < it->second.size(); i++)
+                {
+                    SpatialEntry &entry = m_Entries[it->second[i]];
+                    if (entry.stamp == m_Stamp)
+                        continue;
+
+                    entry.stamp = m_Stamp;
+                    if (overlaps(entry.bounds, area))
+                        result.push_back(entry.object);
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      query (overload #1)
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpatialIndex::query(QFloat x, QFloat y, std::vector<ISpatial *> &result)
+    {
+        update();
+
+        for (std::size_t i = 0; i < m_Large.size(); i++)
+        {
+            SpatialEntry &entry = m_Entries[m_Large[i]];
+            if (contains(entry.bounds, x, y))
+                result.push_back(entry.object);
+        }
+
+        // A point lies in exactly one cell; no duplicates possible
+        std::unordered_map<QUInt64, std::vector<QUInt32> >::iterator it;
+        it = m_Cells.find(cellKey(cellOf(x, m_InvCellSize), cellOf(y, m_InvCellSize)));
+        if (it == m_Cells.end())
+            return;
+
+        for (std::size_t i = 0; i < it->second.size(); i++)
+        {
+            SpatialEntry &entry = m_Entries[it->second[i]];
+            if (contains(entry.bounds, x, y))
+                result.push_back(entry.object);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      queryVisible
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpatialIndex::queryVisible(std::vector<ISpatial *> &result)
+    {
+        query(RectF(0.f, 0.f, m_WinW, m_WinH), result);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      size -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 SpatialIndex::size() const
+    {
+        return m_Count;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      cellSize -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QFloat SpatialIndex::cellSize() const
+    {
+        return m_CellSize;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      cellCount -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 SpatialIndex::cellCount() const
+    {
+        return static_cast<QUInt32>(m_Cells.size());
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      enqueue
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpatialIndex::enqueue(QUInt32 id)
+    {
+        m_Queued.push_back(id);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      place
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpatialIndex::place(QUInt32 id, const RectF &bounds)
+    {
+        SpatialEntry &entry = m_Entries[id];
+        entry.bounds = bounds;
+
+        QInt32 x0 = cellOf(bounds.x(), m_InvCellSize);
+        QInt32 y0 = cellOf(bounds.y(), m_InvCellSize);
+        QInt32 x1 = cellOf(bounds.x() + bounds.width(), m_InvCellSize);
+        QInt32 y1 = cellOf(bounds.y() + bounds.height(), m_InvCellSize);
+        QBool isLarge = static_cast<QUInt64>(static_cast<QInt64>(x1) - x0 + 1) *
+                        static_cast<QUInt64>(static_cast<QInt64>(y1) - y0 + 1) > SPATIAL_MAX_CELLS;
+
+        // Most updates do not leave the covered cells
+        if (isLarge && entry.isLarge)
+            return;
+        if (!isLarge && !entry.isLarge && x0 == entry.x0 &&
+            y0 == entry.y0 && x1 == entry.x1 && y1 == entry.y1)
+        {
+            return;
+        }
+
+        unlink(id);
+        if (isLarge)
+        {
+            entry.isLarge = true;
+            m_Large.push_back(id);
+            return;
+        }
+
+        entry.x0 = x0;
+        entry.y0 = y0;
+        entry.x1 = x1;
+        entry.y1 = y1;
+
+        for (QInt32 cy = y0; cy <= y1; cy++)
+            for (QInt32 cx = x0; cx <= x1; cx++)
+                m_Cells[cellKey(cx, cy)].push_back(id);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      unlink
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpatialIndex::unlink(QUInt32 id)
+    {
+        SpatialEntry &entry = m_Entries[id];
+        if (entry.isLarge)
+        {
+            for (std::size_t i = 0; i < m_Large.size(); i++)
+            {
+                if (m_Large[i] == id)
+                {
+                    m_Large[i] = m_Large.back();
+                    m_Large.pop_back();
+                    break;
+                }
+            }
+
+            entry.isLarge = false;
+            return;
+        }
+
+        // Erases emptied cells, since moving and scrolling content
+        // would otherwise leave ever more of them behind
+        for (QInt32 cy = entry.y0; cy <= entry.y1; cy++)
+        {
+            for (QInt32 cx = entry.x0; cx <= entry.x1; cx++)
+            {
+                std::unordered_map<QUInt64, std::vector<QUInt32> >::iterator it;
+                it = m_Cells.find(cellKey(cx, cy));
+                if (it == m_Cells.end())
+                    continue;
+
+                std::vector<QUInt32> &cell = it->second;
+                for (std::size_t i = 0; i < cell.size(); i++)
+                {
+                    if (cell[i] == id)
+                    {
+                        cell[i] = cell.back();
+                        cell.pop_back();
+                        break;
+                    }
+                }
+
+                if (cell.empty())
+                    m_Cells.erase(it);
+            }
+        }
+
+        entry.x0 = entry.y0 = 0;
+        entry.x1 = entry.y1 = -1;
+    }
+}
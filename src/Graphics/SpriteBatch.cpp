@@ -0,0 +1,737 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Debug/GLCheck.hpp>
+#include <Qube2D/Graphics/SpriteBatch.hpp>
+#include <Qube2D/Graphics/System/Culling.hpp>
+#include <Qube2D/Graphics/System/OpenGL/StreamBuffer.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
+#include <Qube2D/Graphics/System/Shader/TextureShaders.hpp>
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define BATCH_MAX_SPRITES       16384u
+    #define BATCH_SINGLE_VERTEX     (sizeof(float) * 8)
+    #define BATCH_OFFSET_COORD      (const void *)(sizeof(float) * 2)
+    #define BATCH_OFFSET_BLEND      (const void *)(sizeof(float) * 4)
+    #define BATCH_BASE_VERTEX(o)    static_cast<GLint>((o) / BATCH_SINGLE_VERTEX)
+    #define BATCH_DEG_TO_RAD        0.01745329251994329577f
+    #define BATCH_INSTANCE_SIZE     sizeof(SpriteInstance)
+    #define BATCH_MAX_SLOTS         32u
+    #define BATCH_INSTANCE_ATTRIB(i, n, t, norm, base, off)         \
+        glCheck(glVertexAttribPointer(i, n, t, norm,                \
+                    BATCH_INSTANCE_SIZE,                            \
+                    (const void *)((base) + (off))))
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       Qube2D_SpriteBatch_Pack_Color -> inline
+    /// \brief    Converts a vertex color to 8-bit components.
+    ///
+    ///////////////////////////////////////////////////////////
+    inline void Qube2D_SpriteBatch_Pack_Color(const TextureVertex &v, float opacity, unsigned char *rgba)
+    {
+        rgba[0] = static_cast<unsigned char>(std::min(std::max(v.r, 0.f), 1.f) * 255.f + .5f);
+        rgba[1] = static_cast<unsigned char>(std::min(std::max(v.g, 0.f), 1.f) * 255.f + .5f);
+        rgba[2] = static_cast<unsigned char>(std::min(std::max(v.b, 0.f), 1.f) * 255.f + .5f);
+        rgba[3] = static_cast<unsigned char>(std::min(std::max(v.a * opacity, 0.f), 1.f) * 255.f + .5f);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Static class member definitions
+    //
+    ///////////////////////////////////////////////////////////
+    ShaderProgram SpriteBatch::m_InstanceProgram;
+    Shader SpriteBatch::m_VertexShader;
+    Shader SpriteBatch::m_FragShader;
+    ShaderProgram SpriteBatch::m_MultiProgram;
+    Shader SpriteBatch::m_MultiVertexShader;
+    Shader SpriteBatch::m_MultiFragShader;
+    QUInt32 SpriteBatch::m_MaxSlots = 1;
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    SpriteBatch::SpriteBatch()
+        : Uncopyable(),
+          m_SlotCount(0),
+          m_Mode(BatchMode::Vertices),
+          m_Capacity(0),
+          m_Count(0),
+          m_Texture(0),
+          m_Program(NULL),
+          m_BlendMode(BlendMode::NoBlend),
+          m_DrawCalls(0),
+          m_SpriteCount(0)
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      create
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::create(QUInt32 capacity, BatchMode mode)
+    {
+        if (capacity == 0)
+            capacity = 1;
+        if (capacity > BATCH_MAX_SPRITES)
+            capacity = BATCH_MAX_SPRITES;
+
+        m_Mode = mode;
+        m_Capacity = capacity;
+        m_Quads.resize(capacity);
+        if (mode == BatchMode::Instanced)
+            m_Instances.resize(capacity);
+        if (mode == BatchMode::MultiTexture)
+        {
+            m_Slots.resize(capacity * 4);
+            m_SlotTextures.resize(m_MaxSlots);
+        }
+
+
+        // Generates the indices for all quads at once
+        std::vector<QUInt16> indices(capacity * 6);
+        for (QUInt32 i = 0, v = 0; i < capacity * 6; i += 6, v += 4)
+        {
+            indices[i+0] = static_cast<QUInt16>(v + 0);
+            indices[i+1] = static_cast<QUInt16>(v + 1);
+            indices[i+2] = static_cast<QUInt16>(v + 2);
+            indices[i+3] = static_cast<QUInt16>(v + 2);
+            indices[i+4] = static_cast<QUInt16>(v + 3);
+            indices[i+5] = static_cast<QUInt16>(v + 0);
+        }
+
+
+        // The vertex array remembers the attribute layout and the
+        // index buffer, so they only need to be specified once.
+        m_VertexArray.create();
+        m_IndexBuffer.create(BufferType::Index, BufferUsage::Static);
+
+        m_VertexArray.bind();
+        m_IndexBuffer.bind();
+        m_IndexBuffer.fill(indices.data(), sizeof(QUInt16) * capacity * 6);
+        StreamBuffer::vertexStream().bind();
+
+        m_VertexArray.enableAttrib(0);
+        m_VertexArray.enableAttrib(1);
+        m_VertexArray.enableAttrib(2);
+
+        glCheck(glVertexAttribPointer(
+                    0,
+                    2,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    BATCH_SINGLE_VERTEX,
+                    NULL));
+
+        glCheck(glVertexAttribPointer(
+                    1,
+                    2,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    BATCH_SINGLE_VERTEX,
+                    BATCH_OFFSET_COORD));
+
+        glCheck(glVertexAttribPointer(
+                    2,
+                    4,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    BATCH_SINGLE_VERTEX,
+                    BATCH_OFFSET_BLEND));
+
+        m_VertexArray.unbind();
+
+
+        // Instances share the index buffer of the first quad and
+        // source their corners from a static unit quad. The other
+        // attributes advance once per instance.
+        if (mode == BatchMode::Instanced)
+        {
+            const float corners[8] = { 0.f, 0.f, 1.f, 0.f, 1.f, 1.f, 0.f, 1.f };
+
+            m_InstanceArray.create();
+            m_UnitQuad.create(BufferType::Vertex, BufferUsage::Static);
+
+            m_InstanceArray.bind();
+            m_IndexBuffer.bind();
+            m_UnitQuad.bind();
+            m_UnitQuad.fill(corners, sizeof(corners));
+
+            m_InstanceArray.enableAttrib(0);
+            glCheck(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, NULL));
+
+            for (QUInt32 i = 1; i <= 9; i++)
+            {
+                m_InstanceArray.enableAttrib(i);
+                glCheck(glVertexAttribDivisor(i, 1));
+            }
+
+            m_InstanceArray.unbind();
+        }
+
+
+        // The quads and their slots are streamed separately, so
+        // the attribute pointers are specified upon flushing.
+        if (mode == BatchMode::MultiTexture)
+        {
+            m_MultiArray.create();
+            m_MultiArray.bind();
+            m_IndexBuffer.bind();
+
+            for (QUInt32 i = 0; i <= 3; i++)
+                m_MultiArray.enableAttrib(i);
+
+            m_MultiArray.unbind();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      destroy
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::destroy()
+    {
+        if (m_Mode == BatchMode::Instanced)
+        {
+            m_UnitQuad.destroy();
+            m_InstanceArray.destroy();
+        }
+        if (m_Mode == BatchMode::MultiTexture)
+            m_MultiArray.destroy();
+
+        m_IndexBuffer.destroy();
+        m_VertexArray.destroy();
+        m_Quads.clear();
+        m_Instances.clear();
+        m_Slots.clear();
+        m_SlotTextures.clear();
+        m_SlotCount = 0;
+        m_Capacity = 0;
+        m_Count = 0;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      begin
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::begin()
+    {
+        m_Count = 0;
+        m_SlotCount = 0;
+        m_Texture = 0;
+        m_Program = NULL;
+        m_DrawCalls = 0;
+        m_SpriteCount = 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      draw
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::draw(const ISprite &sprite)
+    {
+        if (!sprite.isVisible() || !Culling::isVisible(sprite.bounds()))
+            return;
+
+        // Starts a new run if the render state changes
+        QUInt32 texture = sprite.texture().id();
+        ShaderProgram *program = sprite.shaderProgram();
+        BlendMode mode = sprite.blendMode();
+
+        if (m_Count != 0 && (m_Count == m_Capacity ||
+                             m_Program != program ||
+                             m_BlendMode != mode))
+        {
+            flush();
+        }
+
+        m_Program = program;
+        m_BlendMode = mode;
+
+        if (isMultiTexturing())
+        {
+            // Only starts a new run if the slots are exhausted
+            QInt32 slot = acquireSlot(texture);
+            if (slot < 0)
+            {
+                flush();
+                slot = acquireSlot(texture);
+            }
+
+            float *slots = &m_Slots[m_Count * 4];
+            slots[0] = slots[1] = slots[2] = slots[3] = static_cast<float>(slot);
+            addQuad(sprite);
+        }
+        else
+        {
+            if (m_Count != 0 && m_Texture != texture)
+                flush();
+
+            m_Texture = texture;
+            if (isInstancing())
+                addInstance(sprite);
+            else
+                addQuad(sprite);
+        }
+
+        m_Count++;
+        m_SpriteCount++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      flush
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::flush()
+    {
+        if (m_Count == 0)
+            return;
+
+        // Vertices are transformed already; only project them
+        float projection[16];
+        m_Projection.toMatrix(projection);
+
+        // Each flush counts its draw call only once it is issued
+        if (isMultiTexturing())
+            flushMultiTexture(projection);
+        else if (isInstancing())
+            flushInstances(projection);
+        else
+            flushQuads(projection);
+
+        m_Count = 0;
+        m_SlotCount = 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      end
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::end()
+    {
+        flush();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      drawCalls -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 SpriteBatch::drawCalls() const
+    {
+        return m_DrawCalls;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      spriteCount -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 SpriteBatch::spriteCount() const
+    {
+        return m_SpriteCount;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      mode -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    BatchMode SpriteBatch::mode() const
+    {
+        return m_Mode;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      isInstancing -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool SpriteBatch::isInstancing() const
+    {
+        return m_Mode == BatchMode::Instanced &&
+               m_Program == ISprite::defaultShaderProgram();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      isMultiTexturing -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool SpriteBatch::isMultiTexturing() const
+    {
+        return m_Mode == BatchMode::MultiTexture &&
+               m_Program == ISprite::defaultShaderProgram();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      acquireSlot
+    ///
+    ///////////////////////////////////////////////////////////
+    QInt32 SpriteBatch::acquireSlot(QUInt32 texture)
+    {
+        // Few slots are occupied at once; a linear search is
+        // faster than any kind of lookup table.
+        for (QUInt32 i = 0; i < m_SlotCount; i++)
+        {
+            if (m_SlotTextures[i] == texture)
+                return static_cast<QInt32>(i);
+        }
+
+        if (m_SlotCount == m_SlotTextures.size())
+            return -1;
+
+        m_SlotTextures[m_SlotCount] = texture;
+        return static_cast<QInt32>(m_SlotCount++);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      addQuad
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::addQuad(const ISprite &sprite)
+    {
+        // Uses the cached model transform; trigonometry is only
+        // evaluated again if angle, scale or origin changed.
+        m_Quads.set(m_Count,
+                    sprite.transform().translated(sprite.x(), sprite.y()),
+                    sprite.vertices(),
+                    sprite.opacity());
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      addInstance
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::addInstance(const ISprite &sprite)
+    {
+        const TextureVertices &v = sprite.vertices();
+        SpriteInstance &inst = m_Instances[m_Count];
+        float scl = sprite.scale();
+
+        // Moves the quad's top-left vertex into the position, so
+        // the shader only needs to span the unit quad over w/h.
+        inst.x = sprite.x() + v.v0.x * scl;
+        inst.y = sprite.y() + v.v0.y * scl;
+        inst.w = (v.v2.x - v.v0.x) * scl;
+        inst.h = (v.v2.y - v.v0.y) * scl;
+        inst.ox = sprite.originX() - v.v0.x * scl;
+        inst.oy = sprite.originY() - v.v0.y * scl;
+        inst.angle = sprite.angle() * BATCH_DEG_TO_RAD;
+        inst.u0 = v.v0.u;
+        inst.v0 = v.v0.v;
+        inst.u1 = v.v2.u;
+        inst.v1 = v.v2.v;
+
+        // Packs the blend colors of all corners, including the opacity
+        float opacity = sprite.opacity();
+        Qube2D_SpriteBatch_Pack_Color(v.v0, opacity, inst.rgba[0]);
+        Qube2D_SpriteBatch_Pack_Color(v.v1, opacity, inst.rgba[1]);
+        Qube2D_SpriteBatch_Pack_Color(v.v2, opacity, inst.rgba[2]);
+        Qube2D_SpriteBatch_Pack_Color(v.v3, opacity, inst.rgba[3]);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      flushQuads
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::flushQuads(const float *projection)
+    {
+        // Binds all necessary objects
+        m_VertexArray.bind();
+        m_Program->bind();
+
+        // Transforms the quads right into the shared ring buffer
+        QUInt32 offset = 0;
+        void *range = StreamBuffer::vertexStream().map(
+                    sizeof(TextureVertices) * m_Count,
+                    offset,
+                    BATCH_SINGLE_VERTEX);
+
+        if (range == NULL)
+            return;
+
+        QuadKernel::transform(m_Quads.arrays(), m_Count,
+                              static_cast<TextureVertices *>(range));
+        StreamBuffer::vertexStream().unmap();
+
+        // Binds the texture to unit 0
+        GLState::activeTexture(0);
+        GLState::bindTexture(m_Texture);
+
+        // Forwards the projection and a neutral opacity, since the
+        // opacity of each sprite is baked into its vertex colors.
+        glCheck(glUniform1i(m_Program->getUniformLocation("uni_texture"), 0));
+        glCheck(glUniformMatrix4fv(m_Program->getUniformLocation("uni_mvp"), 1, GL_FALSE, projection));
+        glCheck(glUniform1f(m_Program->getUniformLocation("uni_opacity"), 1.f));
+
+        // Renders all pending sprites
+        glCheck(glDrawElementsBaseVertex(
+                    GL_TRIANGLES,
+                    m_Count * 6,
+                    GL_UNSIGNED_SHORT,
+                    NULL,
+                    BATCH_BASE_VERTEX(offset)));
+
+        m_DrawCalls++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      flushInstances
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::flushInstances(const float *projection)
+    {
+        // Binds all necessary objects
+        m_InstanceArray.bind();
+        m_InstanceProgram.bind();
+
+        // Streams the instances and points the per-instance
+        // attributes to their location within the ring buffer.
+        QUInt32 offset = StreamBuffer::vertexStream().write(
+                    m_Instances.data(),
+                    BATCH_INSTANCE_SIZE * m_Count,
+                    BATCH_INSTANCE_SIZE);
+
+        BATCH_INSTANCE_ATTRIB(1, 2, GL_FLOAT, GL_FALSE, offset, sizeof(float) * 0);
+        BATCH_INSTANCE_ATTRIB(2, 2, GL_FLOAT, GL_FALSE, offset, sizeof(float) * 2);
+        BATCH_INSTANCE_ATTRIB(3, 2, GL_FLOAT, GL_FALSE, offset, sizeof(float) * 4);
+        BATCH_INSTANCE_ATTRIB(4, 1, GL_FLOAT, GL_FALSE, offset, sizeof(float) * 6);
+        BATCH_INSTANCE_ATTRIB(5, 4, GL_FLOAT, GL_FALSE, offset, sizeof(float) * 7);
+        BATCH_INSTANCE_ATTRIB(6, 4, GL_UNSIGNED_BYTE, GL_TRUE, offset, sizeof(float) * 11);
+        BATCH_INSTANCE_ATTRIB(7, 4, GL_UNSIGNED_BYTE, GL_TRUE, offset, sizeof(float) * 12);
+        BATCH_INSTANCE_ATTRIB(8, 4, GL_UNSIGNED_BYTE, GL_TRUE, offset, sizeof(float) * 13);
+        BATCH_INSTANCE_ATTRIB(9, 4, GL_UNSIGNED_BYTE, GL_TRUE, offset, sizeof(float) * 14);
+
+        // Binds the texture to unit 0
+        GLState::activeTexture(0);
+        GLState::bindTexture(m_Texture);
+
+        glCheck(glUniform1i(m_InstanceProgram.getUniformLocation("uni_texture"), 0));
+        glCheck(glUniformMatrix4fv(m_InstanceProgram.getUniformLocation("uni_mvp"), 1, GL_FALSE, projection));
+        glCheck(glUniform1f(m_InstanceProgram.getUniformLocation("uni_opacity"), 1.f));
+
+        // Renders all pending sprites
+        glCheck(glDrawElementsInstanced(
+                    GL_TRIANGLES,
+                    6,
+                    GL_UNSIGNED_SHORT,
+                    NULL,
+                    m_Count));
+
+        m_DrawCalls++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      flushMultiTexture
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::flushMultiTexture(const float *projection)
+    {
+        // Binds all necessary objects
+        m_MultiArray.bind();
+        m_MultiProgram.bind();
+
+        // Reserves the quads and the slots behind them with a single
+        // map, so that the stream never moves on to another region
+        // between the two and fences it before this draw is issued.
+        StreamBuffer &stream = StreamBuffer::vertexStream();
+        QUInt32 quadSize = sizeof(TextureVertices) * m_Count;
+        QUInt32 offset = 0;
+        void *range = stream.map(
+                    quadSize + sizeof(float) * 4 * m_Count,
+                    offset,
+                    BATCH_SINGLE_VERTEX);
+
+        if (range == NULL)
+            return;
+
+        QuadKernel::transform(m_Quads.arrays(), m_Count,
+                              static_cast<TextureVertices *>(range));
+        std::memcpy(static_cast<char *>(range) + quadSize,
+                    m_Slots.data(),
+                    sizeof(float) * 4 * m_Count);
+        stream.unmap();
+
+        // Both ranges start at arbitrary offsets, thus the pointers
+        // are re-specified instead of using a base vertex.
+        QUInt32 slots = offset + quadSize;
+
+        glCheck(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, BATCH_SINGLE_VERTEX,
+                                      (const void *)(size_t)(offset)));
+        glCheck(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, BATCH_SINGLE_VERTEX,
+                                      (const void *)(size_t)(offset + sizeof(float) * 2)));
+        glCheck(glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, BATCH_SINGLE_VERTEX,
+                                      (const void *)(size_t)(offset + sizeof(float) * 4)));
+        glCheck(glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(float),
+                                      (const void *)(size_t)(slots)));
+
+        // Binds each occupied slot to its texture unit. Iterates
+        // backwards, so that unit 0 remains active afterwards.
+        for (QUInt32 i = m_SlotCount; i-- > 0;)
+        {
+            GLState::activeTexture(i);
+            GLState::bindTexture(m_SlotTextures[i]);
+        }
+
+        glCheck(glUniformMatrix4fv(m_MultiProgram.getUniformLocation("uni_mvp"), 1, GL_FALSE, projection));
+        glCheck(glUniform1f(m_MultiProgram.getUniformLocation("uni_opacity"), 1.f));
+
+        // Renders all pending sprites
+        glCheck(glDrawElements(
+                    GL_TRIANGLES,
+                    m_Count * 6,
+                    GL_UNSIGNED_SHORT,
+                    NULL));
+
+        m_DrawCalls++;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      initializeGL
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::initializeGL()
+    {
+        m_InstanceProgram.create();
+        m_VertexShader.create(ShaderType::Vertex);
+        m_FragShader.create(ShaderType::Fragment);
+
+        m_VertexShader.compileFromString(Qube2D_TextureInstanceVertexShader);
+        m_FragShader.compileFromString(Qube2D_TextureFragShader);
+        m_InstanceProgram.addShader(m_VertexShader);
+        m_InstanceProgram.addShader(m_FragShader);
+        m_InstanceProgram.link();
+
+
+        // Samples at most 32 textures, since GLState caches the
+        // bindings of 32 units only.
+        GLint units = 0;
+        glCheck(glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &units));
+        m_MaxSlots = std::min(static_cast<QUInt32>(std::max(units, 1)), BATCH_MAX_SLOTS);
+
+        std::string source = "#version 330 core\n#define Q2D_SLOTS ";
+        source += std::to_string(m_MaxSlots);
+        source += "\n";
+        source += Qube2D_TextureMultiFragShader;
+
+        m_MultiProgram.create();
+        m_MultiVertexShader.create(ShaderType::Vertex);
+        m_MultiFragShader.create(ShaderType::Fragment);
+
+        m_MultiVertexShader.compileFromString(Qube2D_TextureMultiVertexShader);
+        m_MultiFragShader.compileFromString(source.c_str());
+        m_MultiProgram.addShader(m_MultiVertexShader);
+        m_MultiProgram.addShader(m_MultiFragShader);
+        m_MultiProgram.link();
+
+        // Each sampler permanently refers to the unit of its slot
+        GLint samplers[BATCH_MAX_SLOTS];
+        for (QUInt32 i = 0; i < m_MaxSlots; i++)
+            samplers[i] = static_cast<GLint>(i);
+
+        m_MultiProgram.bind();
+        glCheck(glUniform1iv(m_MultiProgram.getUniformLocation("uni_textures"),
+                             static_cast<GLsizei>(m_MaxSlots), samplers));
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      destroyGL
+    ///
+    ///////////////////////////////////////////////////////////
+    void SpriteBatch::destroyGL()
+    {
+        m_VertexShader.destroy();
+        m_FragShader.destroy();
+        m_InstanceProgram.destroy();
+        m_MultiVertexShader.destroy();
+        m_MultiFragShader.destroy();
+        m_MultiProgram.destroy();
+    }
+}
@@ -46,6 +46,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     QFloat m_WinW = 0.f;
     QFloat m_WinH = 0.f;
+    Transform m_Projection = { 1.f, 0.f, 0.f, 1.f, 0.f, 0.f };
 
 
     ///////////////////////////////////////////////////////////
@@ -135,6 +136,7 @@ namespace Qube2D
     {
         m_PosX = x;
         m_PosY = y;
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -299,9 +301,21 @@ namespace Qube2D
                     m_PosX = m_TargetX;
                 }
             }
+
+            boundsChanged();
         }
     }
 
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      boundsChanged
+    ///
+    ///////////////////////////////////////////////////////////
+    void IMovable::boundsChanged()
+    {
+    }
+
 
     ///////////////////////////////////////////////////////////
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
@@ -315,5 +329,13 @@ namespace Qube2D
 
         m_WinW = vp->width();
         m_WinH = vp->height();
+
+        // Equals glm::ortho(0, w, h, 0); only changes with the view
+        m_Projection.a  = 2.f / m_WinW;
+        m_Projection.b  = 0.f;
+        m_Projection.c  = 0.f;
+        m_Projection.d  = -2.f / m_WinH;
+        m_Projection.tx = -1.f;
+        m_Projection.ty = 1.f;
     }
 }
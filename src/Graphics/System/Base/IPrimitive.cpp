@@ -37,9 +37,10 @@
 #include <Qube2D/Debug/Debug.hpp>
 #include <Qube2D/Debug/GLCheck.hpp>
 #include <Qube2D/Graphics/System/Base/IPrimitive.hpp>
+#include <Qube2D/Graphics/System/Culling.hpp>
+#include <Qube2D/Graphics/System/OpenGL/StreamBuffer.hpp>
 #include <Qube2D/Graphics/System/Shader/PrimitiveShaders.hpp>
 #include <Qube2D/System/Structs/GLColor.hpp>
-#include <glm/gtc/matrix_transform.hpp>
 #include <glad/glad.h>
 
 
@@ -49,8 +50,9 @@ namespace Qube2D
     // Constant definitions
     //
     ///////////////////////////////////////////////////////////
-    #define PRIMITIVE_SINGLE_VERTEX     sizeof(float) * 6
+    #define PRIMITIVE_SINGLE_VERTEX     (sizeof(float) * 6)
     #define PRIMITIVE_OFFSET_BLEND      (const void *)(sizeof(float) * 2)
+    #define PRIMITIVE_FIRST_VERTEX(o)   static_cast<GLint>((o) / PRIMITIVE_SINGLE_VERTEX)
 
     ///////////////////////////////////////////////////////////
     // Static class member definitions
@@ -74,6 +76,7 @@ namespace Qube2D
         : IFadable(),
           IMovable(),
           ITransformable(),
+          ISpatial(),
           m_CustomProgram(NULL),
           m_DrawMode(0)
     {
@@ -89,8 +92,6 @@ namespace Qube2D
     void IPrimitive::create()
     {
         m_CustomProgram = &m_ShaderProgram;
-        m_VertexBuffer.create(BufferType::Vertex,
-                              BufferUsage::Dynamic);
     }
 
     ///////////////////////////////////////////////////////////
@@ -101,8 +102,8 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void IPrimitive::destroy()
     {
-        m_VertexBuffer.destroy();
         m_Vertices.v.clear();
+        leaveIndex();
     }
 
 
@@ -119,6 +120,8 @@ namespace Qube2D
         static PrimitiveVertex v = { 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
         for (QUInt32 i = 0; i < count; ++i)
             m_Vertices.add(v);
+
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -195,66 +198,106 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void IPrimitive::render()
     {
-        // Constructs the MVP matrix
-        glm::mat4 identity      = glm::mat4(1.f);
-        glm::mat4 projection    = glm::ortho(0.f, m_WinW, m_WinH, 0.f);
-        glm::mat4 translation   = glm::translate(identity, glm::vec3(x(), y(), 0.f));
-        glm::mat4 origin        = glm::translate(identity, glm::vec3(-originX(), -originY(), 0.f));
-        glm::mat4 rotation      = glm::rotate(identity, glm::radians(angle()), glm::vec3(0.f, 0.f, 1.f));
-        glm::mat4 iorigin       = glm::translate(identity, glm::vec3(originX(), originY(), 0.f));
-        glm::mat4 scaling       = glm::scale(identity, glm::vec3(scale(), scale(), 1.f));
-        glm::mat4 mvp           = projection * translation * iorigin * rotation * origin * scaling * identity;
+        if (!Culling::isVisible(bounds()))
+            return;
+
+        // Constructs the MVP matrix from the cached transform
+        float mvp[16];
+        (m_Projection * transform().translated(x(), y())).toMatrix(mvp);
 
 
         // Binds all necessary objects
         m_VertexArray.bind();
-        m_VertexBuffer.bind();
         m_CustomProgram->bind();
 
-        // Buffers the vertex data
-        m_VertexBuffer.fill(m_Vertices.ptr(), m_Vertices.size() * PRIMITIVE_SINGLE_VERTEX);
+
+        // Streams the vertex data into the shared ring buffer
+        QUInt32 offset = StreamBuffer::vertexStream().write(
+                    m_Vertices.ptr(),
+                    m_Vertices.size() * PRIMITIVE_SINGLE_VERTEX,
+                    PRIMITIVE_SINGLE_VERTEX);
 
         // Forwards the MVP matrix and the opacity to the shader
-        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, &mvp[0][0]));
+        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, mvp));
         glCheck(glUniform1f(m_UniformOpacity, opacity()));
 
-
-        // Enables all the used vertex attributes
-        m_VertexArray.enableAttrib(0);
-        m_VertexArray.enableAttrib(1);
-
-        // Specifies the vertex attributes
-        glCheck(glVertexAttribPointer(
-                    0,
-                    2,
-                    GL_FLOAT,
-                    GL_FALSE,
-                    PRIMITIVE_SINGLE_VERTEX,
-                    NULL));
-
-        glCheck(glVertexAttribPointer(
-                    1,
-                    4,
-                    GL_FLOAT,
-                    GL_FALSE,
-                    PRIMITIVE_SINGLE_VERTEX,
-                    PRIMITIVE_OFFSET_BLEND));
-
         // Renders the primitive
         glCheck(glDrawArrays(
                     m_DrawMode,
-                    GL_ZERO,
+                    PRIMITIVE_FIRST_VERTEX(offset),
                     m_Vertices.size()));
+    }
 
 
-        // Disables all the used vertex attributes
-        m_VertexArray.disableAttrib(1);
-        m_VertexArray.disableAttrib(0);
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      vertices
+    ///
+    ///////////////////////////////////////////////////////////
+    const PolygonVertices &IPrimitive::vertices() const
+    {
+        return m_Vertices;
+    }
 
-        // Unbinds the necessary objects
-        m_VertexArray.unbind();
-        m_VertexBuffer.unbind();
-        m_CustomProgram->unbind();
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      drawMode
+    ///
+    ///////////////////////////////////////////////////////////
+    DrawMode IPrimitive::drawMode() const
+    {
+        return static_cast<DrawMode>(m_DrawMode);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      shaderProgram
+    ///
+    ///////////////////////////////////////////////////////////
+    ShaderProgram *IPrimitive::shaderProgram() const
+    {
+        return m_CustomProgram;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      bounds
+    ///
+    ///////////////////////////////////////////////////////////
+    RectF IPrimitive::bounds() const
+    {
+        if (m_Vertices.v.empty())
+            return RectF(0.f, 0.f, 0.f, 0.f);
+
+        // Finds the local hull of the vertices
+        float minX = m_Vertices.v[0].x, maxX = minX;
+        float minY = m_Vertices.v[0].y, maxY = minY;
+        for (std::size_t i = 1; i < m_Vertices.v.size(); i++)
+        {
+            const PrimitiveVertex &v = m_Vertices.v[i];
+            if (v.x < minX) minX = v.x;
+            if (v.x > maxX) maxX = v.x;
+            if (v.y < minY) minY = v.y;
+            if (v.y > maxY) maxY = v.y;
+        }
+
+        RectF local(minX, minY, maxX - minX, maxY - minY);
+        return transform().translated(x(), y()).mapRect(local);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      boundsChanged
+    ///
+    ///////////////////////////////////////////////////////////
+    void IPrimitive::boundsChanged()
+    {
+        invalidateBounds();
     }
 
 
@@ -280,6 +323,32 @@ namespace Qube2D
 
         m_UniformMatrix = m_ShaderProgram.getUniformLocation("uni_mvp");
         m_UniformOpacity = m_ShaderProgram.getUniformLocation("uni_opacity");
+
+        // The vertex array keeps the vertex layout, which always
+        // sources the shared stream buffer.
+        m_VertexArray.bind();
+        StreamBuffer::vertexStream().bind();
+
+        m_VertexArray.enableAttrib(0);
+        m_VertexArray.enableAttrib(1);
+
+        glCheck(glVertexAttribPointer(
+                    0,
+                    2,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    PRIMITIVE_SINGLE_VERTEX,
+                    NULL));
+
+        glCheck(glVertexAttribPointer(
+                    1,
+                    4,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    PRIMITIVE_SINGLE_VERTEX,
+                    PRIMITIVE_OFFSET_BLEND));
+
+        m_VertexArray.unbind();
     }
 
     ///////////////////////////////////////////////////////////
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/System/Base/ISpatial.hpp>
+#include <Qube2D/Graphics/SpatialIndex.hpp>
+#include <cstddef>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    ISpatial::ISpatial()
+        : m_SpatialIndex(NULL),
+          m_SpatialId(0),
+          m_IsQueued(false)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Copy constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    ISpatial::ISpatial(const ISpatial &)
+        : m_SpatialIndex(NULL),
+          m_SpatialId(0),
+          m_IsQueued(false)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Destructor
+    ///
+    ///////////////////////////////////////////////////////////
+    ISpatial::~ISpatial()
+    {
+        leaveIndex();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Assignment operator
+    ///
+    ///////////////////////////////////////////////////////////
+    ISpatial &ISpatial::operator =(const ISpatial &)
+    {
+        invalidateBounds();
+        return *this;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      spatialIndex -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    SpatialIndex *ISpatial::spatialIndex() const
+    {
+        return m_SpatialIndex;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      invalidateBounds
+    ///
+    ///////////////////////////////////////////////////////////
+    void ISpatial::invalidateBounds()
+    {
+        if (!m_SpatialIndex || m_IsQueued)
+            return;
+
+        m_IsQueued = true;
+        m_SpatialIndex->enqueue(m_SpatialId);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      leaveIndex
+    ///
+    ///////////////////////////////////////////////////////////
+    void ISpatial::leaveIndex()
+    {
+        if (m_SpatialIndex)
+            m_SpatialIndex->remove(this);
+    }
+}
@@ -37,9 +37,11 @@
 #include <Qube2D/Debug/Debug.hpp>
 #include <Qube2D/Debug/GLCheck.hpp>
 #include <Qube2D/Graphics/System/Base/ISprite.hpp>
+#include <Qube2D/Graphics/System/Culling.hpp>
+#include <Qube2D/Graphics/System/OpenGL/StreamBuffer.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
 #include <Qube2D/Graphics/System/Shader/TextureShaders.hpp>
 #include <Qube2D/System/Structs/GLColor.hpp>
-#include <glm/gtc/matrix_transform.hpp>
 #include <glad/glad.h>
 
 
@@ -49,10 +51,11 @@ namespace Qube2D
     // Constant definitions
     //
     ///////////////////////////////////////////////////////////
-    #define IMAGE_VERTEX_SIZE       sizeof(float) * 32
-    #define IMAGE_SINGLE_VERTEX     sizeof(float) * 8
+    #define IMAGE_VERTEX_SIZE       (sizeof(float) * 32)
+    #define IMAGE_SINGLE_VERTEX     (sizeof(float) * 8)
     #define IMAGE_OFFSET_COORD      (const void *)(sizeof(float) * 2)
     #define IMAGE_OFFSET_BLEND      (const void *)(sizeof(float) * 4)
+    #define IMAGE_BASE_VERTEX(o)    static_cast<GLint>((o) / IMAGE_SINGLE_VERTEX)
 
     ///////////////////////////////////////////////////////////
     // Static class member definitions
@@ -78,7 +81,11 @@ namespace Qube2D
         : IFadable(),
           IMovable(),
           ITransformable(),
-          m_CustomProgram(NULL)
+          ISpatial(),
+          m_BlendMode(BlendMode::NoBlend),
+          m_CustomProgram(NULL),
+          m_Region(0.f, 0.f, 0.f, 0.f),
+          m_IsRegion(false)
     {
     }
 
@@ -92,8 +99,6 @@ namespace Qube2D
     void ISprite::create()
     {
         m_CustomProgram = &m_ShaderProgram;
-        m_VertexBuffer.create(BufferType::Vertex,
-                              BufferUsage::Dynamic);
     }
 
     ///////////////////////////////////////////////////////////
@@ -104,8 +109,25 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void ISprite::destroy()
     {
-        m_VertexBuffer.destroy();
-        m_Texture.destroy();
+        releaseTexture();
+        leaveIndex();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      releaseTexture
+    ///
+    ///////////////////////////////////////////////////////////
+    void ISprite::releaseTexture()
+    {
+        // Atlas pages are owned by the Qube2D::TextureAtlas
+        if (m_IsRegion)
+            m_Texture = Texture();
+        else
+            m_Texture.destroy();
+
+        m_IsRegion = false;
     }
 
 
@@ -117,9 +139,13 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     bool ISprite::load(const char *path)
     {
+        // Keeps the sprite in the spatial index while replacing it
+        releaseTexture();
         if (!m_Texture.createFromFile(path))
             return false;
 
+        m_Region = RectF(0.f, 0.f, m_Texture.width(), m_Texture.height());
+
         m_Texture.setMinFilter(InterpolationMode::NearestNeighbor);
         m_Texture.setMagFilter(InterpolationMode::NearestNeighbor);
         setSourceRectangle({ 0.f, 0.f, m_Texture.width(), m_Texture.height() });
@@ -142,6 +168,8 @@ namespace Qube2D
 
         m_Texture = texture;
         m_Texture.bind();
+        m_Region = RectF(0.f, 0.f, m_Texture.width(), m_Texture.height());
+        m_IsRegion = false;
         m_Texture.setMinFilter(InterpolationMode::NearestNeighbor);
         m_Texture.setMagFilter(InterpolationMode::NearestNeighbor);
         setSourceRectangle({ 0.f, 0.f, m_Texture.width(), m_Texture.height() });
@@ -152,6 +180,30 @@ namespace Qube2D
     }
 
 
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      load (overload #2)
+    ///
+    ///////////////////////////////////////////////////////////
+    bool ISprite::load(const TextureRegion &region)
+    {
+        if (region.page.id() == 0)
+            return false;
+
+        // The filters of the page are specified by the atlas
+        releaseTexture();
+        m_Texture = region.page;
+        m_Region = region.area;
+        m_IsRegion = true;
+        setSourceRectangle({ 0.f, 0.f, m_Region.width(), m_Region.height() });
+        setOrigin(m_Region.width()/2, m_Region.height()/2);
+        setBlendColor(Color(255, 255, 255, 255));
+
+        return true;
+    }
+
+
     ///////////////////////////////////////////////////////////
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
     /// \date    September 1st, 2016
@@ -165,8 +217,8 @@ namespace Qube2D
         float tex_h = m_Texture.height();
         float des_w = rect.width();
         float des_h = rect.height();
-        float rel_x = rect.x() / tex_w;
-        float rel_y = rect.y() / tex_h;
+        float rel_x = (m_Region.x() + rect.x()) / tex_w;
+        float rel_y = (m_Region.y() + rect.y()) / tex_h;
         float rel_w = rel_x + (des_w / tex_w);
         float rel_h = rel_y + (des_h / tex_h);
 
@@ -181,6 +233,7 @@ namespace Qube2D
         m_Vertices.v1.uv(rel_w, rel_y);
         m_Vertices.v2.uv(rel_w, rel_h);
         m_Vertices.v3.uv(rel_x, rel_h);
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -282,86 +335,39 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void ISprite::render()
     {
-        // Constructs the MVP matrix
-        glm::mat4 identity      = glm::mat4(1.f);
-        glm::mat4 projection    = glm::ortho(0.f, m_WinW, m_WinH, 0.f);
-        glm::mat4 translation   = glm::translate(identity, glm::vec3(x(), y(), 0.f));
-        glm::mat4 origin        = glm::translate(identity, glm::vec3(-originX(), -originY(), 0.f));
-        glm::mat4 rotation      = glm::rotate(identity, glm::radians(angle()), glm::vec3(0.f, 0.f, 1.f));
-        glm::mat4 iorigin       = glm::translate(identity, glm::vec3(originX(), originY(), 0.f));
-        glm::mat4 scaling       = glm::scale(identity, glm::vec3(scale(), scale(), 1.f));
-        glm::mat4 mvp           = projection * translation * iorigin * rotation * origin * scaling * identity;
+        if (!Culling::isVisible(bounds()))
+            return;
+
+        // Constructs the MVP matrix from the cached transform
+        float mvp[16];
+        (m_Projection * transform().translated(x(), y())).toMatrix(mvp);
 
 
         // Binds all necessary objects
         m_VertexArray.bind();
-        m_IndexBuffer.bind();
-        m_VertexBuffer.bind();
         m_CustomProgram->bind();
 
 
-        // Buffers the vertex data
-        m_VertexBuffer.fill(&m_Vertices, IMAGE_VERTEX_SIZE);
+        // Streams the vertex data into the shared ring buffer
+        QUInt32 offset = StreamBuffer::vertexStream().write(
+                    &m_Vertices, IMAGE_VERTEX_SIZE, IMAGE_SINGLE_VERTEX);
 
         // Binds the texture to unit 0
-        glCheck(glActiveTexture(GL_TEXTURE0));
+        GLState::activeTexture(0);
         m_Texture.bind();
         glCheck(glUniform1i(m_UniformSampler, 0));
 
         // Forwards the MVP matrix and the opacity to the shader
-        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, &mvp[0][0]));
+        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, mvp));
         glCheck(glUniform1f(m_UniformOpacity, opacity()));
 
-
-        // Enables all the used vertex attributes
-        m_VertexArray.enableAttrib(0);
-        m_VertexArray.enableAttrib(1);
-        m_VertexArray.enableAttrib(2);
-
-        // Specifies the vertex attributes
-        glCheck(glVertexAttribPointer(
-                    0,
-                    2,
-                    GL_FLOAT,
-                    GL_FALSE,
-                    IMAGE_SINGLE_VERTEX,
-                    NULL));
-
-        glCheck(glVertexAttribPointer(
-                    1,
-                    2,
-                    GL_FLOAT,
-                    GL_FALSE,
-                    IMAGE_SINGLE_VERTEX,
-                    IMAGE_OFFSET_COORD));
-
-        glCheck(glVertexAttribPointer(
-                    2,
-                    4,
-                    GL_FLOAT,
-                    GL_FALSE,
-                    IMAGE_SINGLE_VERTEX,
-                    IMAGE_OFFSET_BLEND));
-
         // Renders the texture
-        glCheck(glDrawElements(
+        glCheck(glDrawElementsBaseVertex(
                     GL_TRIANGLES,
                     6,
                     GL_UNSIGNED_INT,
-                    NULL));
-
-
-        // Disables all the used vertex attributes
-        m_VertexArray.disableAttrib(2);
-        m_VertexArray.disableAttrib(1);
-        m_VertexArray.disableAttrib(0);
-
-        // Unbinds the necessary objects
-        m_Texture.unbind();
-        m_VertexArray.unbind();
-        m_IndexBuffer.unbind();
-        m_VertexBuffer.unbind();
-        m_CustomProgram->unbind();
+                    NULL,
+                    IMAGE_BASE_VERTEX(offset)));
     }
 
     ///////////////////////////////////////////////////////////
@@ -372,108 +378,52 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void ISprite::startRendering()
     {
-        // Constructs the MVP matrix
-        glm::mat4 identity      = glm::mat4(1.f);
-        glm::mat4 projection    = glm::ortho(0.f, m_WinW, m_WinH, 0.f);
-        glm::mat4 translation   = glm::translate(identity, glm::vec3(x(), y(), 0.f));
-        glm::mat4 origin        = glm::translate(identity, glm::vec3(-originX(), -originY(), 0.f));
-        glm::mat4 rotation      = glm::rotate(identity, glm::radians(angle()), glm::vec3(0.f, 0.f, 1.f));
-        glm::mat4 iorigin       = glm::translate(identity, glm::vec3(originX(), originY(), 0.f));
-        glm::mat4 scaling       = glm::scale(identity, glm::vec3(scale(), scale(), 1.f));
-        glm::mat4 mvp           = projection * translation * iorigin * rotation * origin * scaling * identity;
+        // Constructs the MVP matrix from the cached transform
+        float mvp[16];
+        (m_Projection * transform().translated(x(), y())).toMatrix(mvp);
 
 
         // Binds all necessary objects
         m_VertexArray.bind();
-        m_IndexBuffer.bind();
-        m_VertexBuffer.bind();
         m_CustomProgram->bind();
 
 
-        // Buffers the vertex data
-        m_VertexBuffer.fill(&m_Vertices, IMAGE_VERTEX_SIZE);
-
         // Binds the texture to unit 0
-        glCheck(glActiveTexture(GL_TEXTURE0));
+        GLState::activeTexture(0);
         m_Texture.bind();
         glCheck(glUniform1i(m_UniformSampler, 0));
 
         // Forwards the MVP matrix and the opacity to the shader
-        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, &mvp[0][0]));
+        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, mvp));
         glCheck(glUniform1f(m_UniformOpacity, opacity()));
-
-
-        // Enables all the used vertex attributes
-        m_VertexArray.enableAttrib(0);
-        m_VertexArray.enableAttrib(1);
-        m_VertexArray.enableAttrib(2);
-
-        // Specifies the vertex attributes
-        glCheck(glVertexAttribPointer(
-                    0,
-                    2,
-                    GL_FLOAT,
-                    GL_FALSE,
-                    IMAGE_SINGLE_VERTEX,
-                    NULL));
-
-        glCheck(glVertexAttribPointer(
-                    1,
-                    2,
-                    GL_FLOAT,
-                    GL_FALSE,
-                    IMAGE_SINGLE_VERTEX,
-                    IMAGE_OFFSET_COORD));
-
-        glCheck(glVertexAttribPointer(
-                    2,
-                    4,
-                    GL_FLOAT,
-                    GL_FALSE,
-                    IMAGE_SINGLE_VERTEX,
-                    IMAGE_OFFSET_BLEND));
     }
 
     void ISprite::proceedRendering()
     {
-        // Constructs the MVP matrix
-        glm::mat4 identity      = glm::mat4(1.f);
-        glm::mat4 projection    = glm::ortho(0.f, m_WinW, m_WinH, 0.f);
-        glm::mat4 translation   = glm::translate(identity, glm::vec3(x(), y(), 0.f));
-        glm::mat4 origin        = glm::translate(identity, glm::vec3(-originX(), -originY(), 0.f));
-        glm::mat4 rotation      = glm::rotate(identity, glm::radians(angle()), glm::vec3(0.f, 0.f, 1.f));
-        glm::mat4 iorigin       = glm::translate(identity, glm::vec3(originX(), originY(), 0.f));
-        glm::mat4 scaling       = glm::scale(identity, glm::vec3(scale(), scale(), 1.f));
-        glm::mat4 mvp           = projection * translation * iorigin * rotation * origin * scaling;
+        // Constructs the MVP matrix from the cached transform
+        float mvp[16];
+        (m_Projection * transform().translated(x(), y())).toMatrix(mvp);
 
         // Forwards the MVP matrix to the shader
-        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, &mvp[0][0]));
+        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, mvp));
 
-        // Buffers the vertex data
-        m_VertexBuffer.fill(&m_Vertices, IMAGE_VERTEX_SIZE);
+        // Streams the vertex data into the shared ring buffer
+        QUInt32 offset = StreamBuffer::vertexStream().write(
+                    &m_Vertices, IMAGE_VERTEX_SIZE, IMAGE_SINGLE_VERTEX);
 
 
         // Renders the texture
-        glCheck(glDrawElements(
+        glCheck(glDrawElementsBaseVertex(
                     GL_TRIANGLES,
                     6,
                     GL_UNSIGNED_INT,
-                    NULL));
+                    NULL,
+                    IMAGE_BASE_VERTEX(offset)));
     }
 
     void ISprite::doneRendering()
     {
-        // Disables all the used vertex attributes
-        m_VertexArray.disableAttrib(2);
-        m_VertexArray.disableAttrib(1);
-        m_VertexArray.disableAttrib(0);
-
-        // Unbinds the necessary objects
-        m_Texture.unbind();
-        m_VertexArray.unbind();
-        m_IndexBuffer.unbind();
-        m_VertexBuffer.unbind();
-        m_CustomProgram->unbind();
+        // Bindings are left as they are; see Qube2D::GLState
     }
 
 
@@ -503,9 +453,43 @@ namespace Qube2D
         m_UniformSampler = m_ShaderProgram.getUniformLocation("uni_texture");
         m_UniformOpacity = m_ShaderProgram.getUniformLocation("uni_opacity");
 
+        // The vertex array keeps the index buffer and the vertex
+        // layout, which always sources the shared stream buffer.
+        m_VertexArray.bind();
         m_IndexBuffer.create(BufferType::Index, BufferUsage::Static);
         m_IndexBuffer.bind();
         m_IndexBuffer.fill(indices, sizeof(QUInt32) * 6);
+        StreamBuffer::vertexStream().bind();
+
+        m_VertexArray.enableAttrib(0);
+        m_VertexArray.enableAttrib(1);
+        m_VertexArray.enableAttrib(2);
+
+        glCheck(glVertexAttribPointer(
+                    0,
+                    2,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    IMAGE_SINGLE_VERTEX,
+                    NULL));
+
+        glCheck(glVertexAttribPointer(
+                    1,
+                    2,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    IMAGE_SINGLE_VERTEX,
+                    IMAGE_OFFSET_COORD));
+
+        glCheck(glVertexAttribPointer(
+                    2,
+                    4,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    IMAGE_SINGLE_VERTEX,
+                    IMAGE_OFFSET_BLEND));
+
+        m_VertexArray.unbind();
     }
 
     ///////////////////////////////////////////////////////////
@@ -532,7 +516,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     QFloat ISprite::visibleWidth() const
     {
-        return m_Texture.width() * scale();
+        return (m_IsRegion ? m_Region.width() : m_Texture.width()) * scale();
     }
 
     ///////////////////////////////////////////////////////////
@@ -543,7 +527,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     QFloat ISprite::visibleHeight() const
     {
-        return m_Texture.height () * scale();
+        return (m_IsRegion ? m_Region.height() : m_Texture.height()) * scale();
     }
 
     ///////////////////////////////////////////////////////////
@@ -556,4 +540,86 @@ namespace Qube2D
     {
         return m_Texture;
     }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      vertices
+    ///
+    ///////////////////////////////////////////////////////////
+    const TextureVertices &ISprite::vertices() const
+    {
+        return m_Vertices;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      blendMode
+    ///
+    ///////////////////////////////////////////////////////////
+    BlendMode ISprite::blendMode() const
+    {
+        return m_BlendMode;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      shaderProgram
+    ///
+    ///////////////////////////////////////////////////////////
+    ShaderProgram *ISprite::shaderProgram() const
+    {
+        return m_CustomProgram;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      defaultShaderProgram -> static
+    ///
+    ///////////////////////////////////////////////////////////
+    ShaderProgram *ISprite::defaultShaderProgram()
+    {
+        return &m_ShaderProgram;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      isVisible
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool ISprite::isVisible() const
+    {
+        return m_Texture.id() != 0 && m_CustomProgram != NULL;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      bounds
+    ///
+    ///////////////////////////////////////////////////////////
+    RectF ISprite::bounds() const
+    {
+        RectF local(m_Vertices.v0.x,
+                    m_Vertices.v0.y,
+                    m_Vertices.v2.x - m_Vertices.v0.x,
+                    m_Vertices.v2.y - m_Vertices.v0.y);
+
+        return transform().translated(x(), y()).mapRect(local);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      boundsChanged
+    ///
+    ///////////////////////////////////////////////////////////
+    void ISprite::boundsChanged()
+    {
+        invalidateBounds();
+    }
 }
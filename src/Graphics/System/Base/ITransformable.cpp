@@ -36,6 +36,7 @@
 ///////////////////////////////////////////////////////////
 #include <Qube2D/Debug/Debug.hpp>
 #include <Qube2D/Graphics/System/Base/ITransformable.hpp>
+#include <cmath>
 
 
 namespace Qube2D
@@ -57,7 +58,10 @@ namespace Qube2D
           m_SpeedScaling(0.1f),
           m_TargetRotation(0.f),
           m_TargetScaling(0.f),
-          m_RotateDirection(0)
+          m_RotateDirection(0),
+          m_OriginX(0.f),
+          m_OriginY(0.f),
+          m_IsDirty(true)
     {
     }
 
@@ -84,6 +88,33 @@ namespace Qube2D
         return m_Scale;
     }
 
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      transform -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    const Transform &ITransformable::transform() const
+    {
+        if (m_IsDirty)
+        {
+            // Equals origin * rotation * -origin * scaling
+            float rad = m_Angle * 0.01745329251994329577f;
+            float cos = std::cos(rad);
+            float sin = std::sin(rad);
+
+            m_Transform.a  = cos * m_Scale;
+            m_Transform.b  = sin * m_Scale;
+            m_Transform.c  = -sin * m_Scale;
+            m_Transform.d  = cos * m_Scale;
+            m_Transform.tx = m_OriginX - (cos * m_OriginX - sin * m_OriginY);
+            m_Transform.ty = m_OriginY - (sin * m_OriginX + cos * m_OriginY);
+            m_IsDirty = false;
+        }
+
+        return m_Transform;
+    }
+
     ///////////////////////////////////////////////////////////
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
     /// \date    September 7th, 2016
@@ -116,6 +147,8 @@ namespace Qube2D
     void ITransformable::setRotation(QFloat angle)
     {
         m_Angle = angle;
+        m_IsDirty = true;
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -127,6 +160,8 @@ namespace Qube2D
     void ITransformable::setScale(QFloat scale)
     {
         m_Scale = scale;
+        m_IsDirty = true;
+        boundsChanged();
     }
 
     ///////////////////////////////////////////////////////////
@@ -161,6 +196,8 @@ namespace Qube2D
     {
         m_OriginX = x;
         m_OriginY = y;
+        m_IsDirty = true;
+        boundsChanged();
     }
 
 
@@ -268,6 +305,8 @@ namespace Qube2D
 
 
             m_ElapsedTimeR = 0.0;
+            m_IsDirty = true;
+            boundsChanged();
         }
     }
 
@@ -310,6 +349,18 @@ namespace Qube2D
 
 
             m_ElapsedTimeS = 0.0;
+            m_IsDirty = true;
+            boundsChanged();
         }
     }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      boundsChanged
+    ///
+    ///////////////////////////////////////////////////////////
+    void ITransformable::boundsChanged()
+    {
+    }
 }
@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/System/Culling.hpp>
+#include <Qube2D/Graphics/System/Base/IMovable.hpp>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Static class member definitions
+    //
+    ///////////////////////////////////////////////////////////
+    CullStats Culling::m_Current = { 0, 0 };
+    CullStats Culling::m_Last = { 0, 0 };
+    QBool Culling::m_IsEnabled = true;
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      isVisible
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Culling::isVisible(const RectF &bounds)
+    {
+        if (!m_IsEnabled)
+            return true;
+
+        m_Current.tested++;
+        if (bounds.x() >= m_WinW || bounds.y() >= m_WinH ||
+            bounds.x() + bounds.width() <= 0.f ||
+            bounds.y() + bounds.height() <= 0.f)
+        {
+            m_Current.culled++;
+            return false;
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      setEnabled
+    ///
+    ///////////////////////////////////////////////////////////
+    void Culling::setEnabled(QBool enabled)
+    {
+        m_IsEnabled = enabled;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      isEnabled
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Culling::isEnabled()
+    {
+        return m_IsEnabled;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      stats
+    ///
+    ///////////////////////////////////////////////////////////
+    const CullStats &Culling::stats()
+    {
+        return m_Last;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      finishFrame
+    ///
+    ///////////////////////////////////////////////////////////
+    void Culling::finishFrame()
+    {
+        m_Last = m_Current;
+        m_Current.tested = 0;
+        m_Current.culled = 0;
+    }
+}
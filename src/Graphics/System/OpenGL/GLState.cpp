@@ -0,0 +1,334 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Debug/GLCheck.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
+#include <glad/glad.h>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define GLSTATE_UNKNOWN     0xFFFFFFFFu
+    #define GLSTATE_UNITS       32u
+
+    ///////////////////////////////////////////////////////////
+    // Static class member definitions
+    //
+    ///////////////////////////////////////////////////////////
+    QUInt32 GLState::m_VertexArray = GLSTATE_UNKNOWN;
+    QUInt32 GLState::m_ArrayBuffer = GLSTATE_UNKNOWN;
+    QUInt32 GLState::m_ElementBuffer = GLSTATE_UNKNOWN;
+    QUInt32 GLState::m_Program = GLSTATE_UNKNOWN;
+    QUInt32 GLState::m_ActiveUnit = GLSTATE_UNKNOWN;
+    QUInt32 GLState::m_Textures[GLSTATE_UNITS] =
+    {
+        GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN,
+        GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN,
+        GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN,
+        GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN,
+        GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN,
+        GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN,
+        GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN,
+        GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN, GLSTATE_UNKNOWN
+    };
+    QUInt64 GLState::m_Issued = 0;
+    QUInt64 GLState::m_Skipped = 0;
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      bindVertexArray
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::bindVertexArray(QUInt32 id)
+    {
+        if (m_VertexArray == id)
+        {
+            m_Skipped++;
+            return;
+        }
+
+        glCheck(glBindVertexArray(id));
+        m_VertexArray = id;
+        m_ElementBuffer = GLSTATE_UNKNOWN;
+        m_Issued++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      bindBuffer
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::bindBuffer(QUInt32 target, QUInt32 id)
+    {
+        QUInt32 *bound = NULL;
+        if (target == GL_ARRAY_BUFFER)
+            bound = &m_ArrayBuffer;
+        else if (target == GL_ELEMENT_ARRAY_BUFFER)
+            bound = &m_ElementBuffer;
+
+        if (bound && *bound == id)
+        {
+            m_Skipped++;
+            return;
+        }
+
+        glCheck(glBindBuffer(target, id));
+        if (bound)
+            *bound = id;
+
+        m_Issued++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      useProgram
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::useProgram(QUInt32 id)
+    {
+        if (m_Program == id)
+        {
+            m_Skipped++;
+            return;
+        }
+
+        glCheck(glUseProgram(id));
+        m_Program = id;
+        m_Issued++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      activeTexture
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::activeTexture(QUInt32 unit)
+    {
+        if (m_ActiveUnit == unit)
+        {
+            m_Skipped++;
+            return;
+        }
+
+        glCheck(glActiveTexture(GL_TEXTURE0 + unit));
+        m_ActiveUnit = unit;
+        m_Issued++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      bindTexture
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::bindTexture(QUInt32 id)
+    {
+        // Units beyond the tracked ones are always forwarded
+        QUInt32 *bound = NULL;
+        if (m_ActiveUnit < GLSTATE_UNITS)
+            bound = &m_Textures[m_ActiveUnit];
+
+        if (bound && *bound == id)
+        {
+            m_Skipped++;
+            return;
+        }
+
+        glCheck(glBindTexture(GL_TEXTURE_2D, id));
+        if (bound)
+            *bound = id;
+
+        m_Issued++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      enableAttrib
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::enableAttrib(QUInt32 &mask, QUInt32 location)
+    {
+        if (mask & (1u << location))
+        {
+            m_Skipped++;
+            return;
+        }
+
+        glCheck(glEnableVertexAttribArray(location));
+        mask |= (1u << location);
+        m_Issued++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      disableAttrib
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::disableAttrib(QUInt32 &mask, QUInt32 location)
+    {
+        if (!(mask & (1u << location)))
+        {
+            m_Skipped++;
+            return;
+        }
+
+        glCheck(glDisableVertexAttribArray(location));
+        mask &= ~(1u << location);
+        m_Issued++;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      forgetVertexArray
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::forgetVertexArray(QUInt32 id)
+    {
+        if (m_VertexArray == id)
+        {
+            m_VertexArray = GLSTATE_UNKNOWN;
+            m_ElementBuffer = GLSTATE_UNKNOWN;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      forgetBuffer
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::forgetBuffer(QUInt32 id)
+    {
+        if (m_ArrayBuffer == id)
+            m_ArrayBuffer = GLSTATE_UNKNOWN;
+        if (m_ElementBuffer == id)
+            m_ElementBuffer = GLSTATE_UNKNOWN;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      forgetProgram
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::forgetProgram(QUInt32 id)
+    {
+        if (m_Program == id)
+            m_Program = GLSTATE_UNKNOWN;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      forgetTexture
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::forgetTexture(QUInt32 id)
+    {
+        for (QUInt32 i = 0; i < GLSTATE_UNITS; i++)
+        {
+            if (m_Textures[i] == id)
+                m_Textures[i] = GLSTATE_UNKNOWN;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      invalidate
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::invalidate()
+    {
+        m_VertexArray = GLSTATE_UNKNOWN;
+        m_ArrayBuffer = GLSTATE_UNKNOWN;
+        m_ElementBuffer = GLSTATE_UNKNOWN;
+        m_Program = GLSTATE_UNKNOWN;
+        m_ActiveUnit = GLSTATE_UNKNOWN;
+
+        for (QUInt32 i = 0; i < GLSTATE_UNITS; i++)
+            m_Textures[i] = GLSTATE_UNKNOWN;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      issuedCalls
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt64 GLState::issuedCalls()
+    {
+        return m_Issued;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      skippedCalls
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt64 GLState::skippedCalls()
+    {
+        return m_Skipped;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      resetCounters
+    ///
+    ///////////////////////////////////////////////////////////
+    void GLState::resetCounters()
+    {
+        m_Issued = 0;
+        m_Skipped = 0;
+    }
+}
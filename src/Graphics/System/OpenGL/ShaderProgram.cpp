@@ -37,6 +37,7 @@
 #include <Qube2D/Debug/Debug.hpp>
 #include <Qube2D/Debug/GLCheck.hpp>
 #include <Qube2D/Graphics/System/OpenGL/GLErrors.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
 #include <Qube2D/Graphics/System/OpenGL/ShaderProgram.hpp>
 #include <glad/glad.h>
 
@@ -74,6 +75,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void ShaderProgram::destroy()
     {
+        GLState::forgetProgram(m_ID);
         glCheck(glDeleteProgram(m_ID));
         m_ID = 0;
     }
@@ -146,7 +148,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void ShaderProgram::bind()
     {
-        glCheck(glUseProgram(m_ID));
+        GLState::useProgram(m_ID);
     }
 
     ///////////////////////////////////////////////////////////
@@ -157,7 +159,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void ShaderProgram::unbind()
     {
-        glCheck(glUseProgram(0));
+        GLState::useProgram(0);
     }
 
 
@@ -0,0 +1,325 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Debug/Debug.hpp>
+#include <Qube2D/Debug/GLCheck.hpp>
+#include <Qube2D/Graphics/System/OpenGL/StreamBuffer.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLErrors.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
+#include <glad/glad.h>
+#include <cstring>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define STREAM_REGION_COUNT     3u
+    #define STREAM_DEFAULT_REGION   (4u * 1024u * 1024u)
+    #define STREAM_WAIT_TIMEOUT     1000000u
+    #define STREAM_ALIGN(o, a)      ((((o) + (a) - 1) / (a)) * (a))
+    #define STREAM_MAP_FLAGS        (GL_MAP_WRITE_BIT |             \
+                                     GL_MAP_UNSYNCHRONIZED_BIT |    \
+                                     GL_MAP_INVALIDATE_RANGE_BIT)
+
+    ///////////////////////////////////////////////////////////
+    // Static class member definitions
+    //
+    ///////////////////////////////////////////////////////////
+    StreamBuffer StreamBuffer::m_VertexStream;
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    StreamBuffer::StreamBuffer()
+        : Uncopyable(),
+          m_ID(0),
+          m_RegionSize(0),
+          m_Region(0),
+          m_Offset(0)
+    {
+        for (QUInt32 i = 0; i < STREAM_REGION_COUNT; i++)
+            m_Fences[i] = NULL;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      create
+    ///
+    ///////////////////////////////////////////////////////////
+    void StreamBuffer::create(QUInt32 regionSize)
+    {
+        m_RegionSize = regionSize;
+        m_Region = 0;
+        m_Offset = 0;
+
+        glCheck(glGenBuffers(1, &m_ID));
+        bind();
+        glCheck(glBufferData(GL_ARRAY_BUFFER,
+                             m_RegionSize * STREAM_REGION_COUNT,
+                             NULL,
+                             GL_STREAM_DRAW));
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      destroy
+    ///
+    ///////////////////////////////////////////////////////////
+    void StreamBuffer::destroy()
+    {
+        for (QUInt32 i = 0; i < STREAM_REGION_COUNT; i++)
+            wait(i);
+
+        GLState::forgetBuffer(m_ID);
+        glCheck(glDeleteBuffers(1, &m_ID));
+        m_ID = 0;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      id -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 StreamBuffer::id() const
+    {
+        return m_ID;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      bind
+    ///
+    ///////////////////////////////////////////////////////////
+    void StreamBuffer::bind()
+    {
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_ID);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      map
+    ///
+    ///////////////////////////////////////////////////////////
+    void *StreamBuffer::map(QUInt32 size, QUInt32 &offset, QUInt32 alignment)
+    {
+        // Region starts need not be multiples of the alignment,
+        // thus a region must hold the padding in front, as well.
+        if (size + alignment - 1 > m_RegionSize)
+            grow(size + alignment - 1);
+
+        // Aligns the offset; moves on to the next region early if
+        // the current one cannot hold the requested amount of bytes.
+        QUInt32 start = STREAM_ALIGN(m_Offset, alignment);
+        QUInt32 end = (m_Region + 1) * m_RegionSize;
+        if (start + size > end)
+        {
+            advance();
+            start = STREAM_ALIGN(m_Offset, alignment);
+        }
+
+        m_Offset = start + size;
+        offset = start;
+
+        bind();
+        void *range = glMapBufferRange(GL_ARRAY_BUFFER, start, size, STREAM_MAP_FLAGS);
+        if (range == NULL)
+            Q2DErrorNoArg(Q2D_STREAM_ERROR_0);
+
+        return range;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      unmap
+    ///
+    ///////////////////////////////////////////////////////////
+    void StreamBuffer::unmap()
+    {
+        glCheck(glUnmapBuffer(GL_ARRAY_BUFFER));
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      write
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 StreamBuffer::write(const void *data, QUInt32 size, QUInt32 alignment)
+    {
+        QUInt32 offset = 0;
+        if (size == 0)
+            return offset;
+
+        void *range = map(size, offset, alignment);
+        if (range != NULL)
+        {
+            std::memcpy(range, data, size);
+            unmap();
+        }
+
+        return offset;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      finishFrame
+    ///
+    ///////////////////////////////////////////////////////////
+    void StreamBuffer::finishFrame()
+    {
+        // Only wastes the remainder of a region if it was used
+        if (m_Offset != m_Region * m_RegionSize)
+            advance();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      advance
+    ///
+    ///////////////////////////////////////////////////////////
+    void StreamBuffer::advance()
+    {
+        m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        m_Region = (m_Region + 1) % STREAM_REGION_COUNT;
+        m_Offset = m_Region * m_RegionSize;
+
+        wait(m_Region);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      wait
+    ///
+    ///////////////////////////////////////////////////////////
+    void StreamBuffer::wait(QUInt32 region)
+    {
+        GLsync fence = static_cast<GLsync>(m_Fences[region]);
+        if (fence == NULL)
+            return;
+
+        GLenum result;
+        do
+        {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, STREAM_WAIT_TIMEOUT);
+        } while (result == GL_TIMEOUT_EXPIRED);
+
+        glCheck(glDeleteSync(fence));
+        m_Fences[region] = NULL;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      grow
+    ///
+    ///////////////////////////////////////////////////////////
+    void StreamBuffer::grow(QUInt32 size)
+    {
+        QUInt32 regionSize = m_RegionSize ? m_RegionSize : size;
+        while (regionSize < size)
+            regionSize *= 2;
+
+        // Waits until no draw reads from any region anymore, so
+        // that no fence outlives the storage it was placed for.
+        for (QUInt32 i = 0; i < STREAM_REGION_COUNT; i++)
+            wait(i);
+
+        m_RegionSize = regionSize;
+        m_Region = 0;
+        m_Offset = 0;
+
+        bind();
+        glCheck(glBufferData(GL_ARRAY_BUFFER,
+                             m_RegionSize * STREAM_REGION_COUNT,
+                             NULL,
+                             GL_STREAM_DRAW));
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      vertexStream -> static
+    ///
+    ///////////////////////////////////////////////////////////
+    StreamBuffer &StreamBuffer::vertexStream()
+    {
+        return m_VertexStream;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      initializeGL -> static
+    ///
+    ///////////////////////////////////////////////////////////
+    void StreamBuffer::initializeGL()
+    {
+        m_VertexStream.create(STREAM_DEFAULT_REGION);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      destroyGL -> static
+    ///
+    ///////////////////////////////////////////////////////////
+    void StreamBuffer::destroyGL()
+    {
+        m_VertexStream.destroy();
+    }
+}
@@ -35,6 +35,7 @@
 //
 ///////////////////////////////////////////////////////////
 #include <Qube2D/Graphics/System/OpenGL/GLErrors.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
 #include <Qube2D/Graphics/System/OpenGL/Texture.hpp>
 #include <Qube2D/System/Storage/File.hpp>
 #include <Qube2D/Assets/Assets.hpp>
@@ -84,7 +85,7 @@ namespace Qube2D
 
         // Creates an OpenGL texture
         glCheck(glGenTextures(1, &m_ID));
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_ID));
+        GLState::bindTexture(m_ID);
 
         // Generates the initial texture data
         if (color.a() != 0)
@@ -218,7 +219,7 @@ namespace Qube2D
 
         // Allocates an OpenGL texture
         glCheck(glGenTextures(1, &m_ID));
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_ID));
+        GLState::bindTexture(m_ID);
         glCheck(glTexImage2D(
                     GL_TEXTURE_2D, GL_NONE,
                     GL_RGBA,
@@ -243,7 +244,10 @@ namespace Qube2D
     void Texture::destroy()
     {
         if (m_ID)
+        {
+            GLState::forgetTexture(m_ID);
             glDeleteTextures(1, &m_ID);
+        }
 
         m_ID = 0;
         m_Width = 0;
@@ -259,7 +263,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void Texture::bind()
     {
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_ID));
+        GLState::bindTexture(m_ID);
     }
 
     ///////////////////////////////////////////////////////////
@@ -270,7 +274,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void Texture::unbind()
     {
-        glCheck(glBindTexture(GL_TEXTURE_2D, 0));
+        GLState::bindTexture(0);
     }
 
 
@@ -370,7 +374,7 @@ namespace Qube2D
                                const RectI &rect,
                                TextureFormat format)
     {
-        assert(data && m_ID);
+        assert(m_ID);
 
 
         // Determines the unpacking alignment
@@ -383,7 +387,7 @@ namespace Qube2D
 
 
         // Updates the pixel data
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_ID));
+        GLState::bindTexture(m_ID);
         glCheck(glTexSubImage2D(
                     GL_TEXTURE_2D, GL_NONE,
                     rect.x(), rect.y(),
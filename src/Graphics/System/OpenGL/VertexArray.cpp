@@ -35,6 +35,7 @@
 //
 ///////////////////////////////////////////////////////////
 #include <Qube2D/Graphics/System/OpenGL/VertexArray.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
 #include <Qube2D/Debug/GLCheck.hpp>
 #include <glad/glad.h>
 
@@ -48,7 +49,8 @@ namespace Qube2D
     ///
     ///////////////////////////////////////////////////////////
     VertexArray::VertexArray()
-        : m_ID(0)
+        : m_ID(0),
+          m_Attribs(0)
     {
     }
 
@@ -62,6 +64,7 @@ namespace Qube2D
     void VertexArray::create()
     {
         glCheck(glGenVertexArrays(1, &m_ID));
+        m_Attribs = 0;
     }
 
     ///////////////////////////////////////////////////////////
@@ -72,6 +75,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void VertexArray::destroy()
     {
+        GLState::forgetVertexArray(m_ID);
         glCheck(glDeleteVertexArrays(1, &m_ID));
         m_ID = 0;
     }
@@ -97,7 +101,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void VertexArray::bind()
     {
-        glCheck(glBindVertexArray(m_ID));
+        GLState::bindVertexArray(m_ID);
     }
 
     ///////////////////////////////////////////////////////////
@@ -108,7 +112,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void VertexArray::unbind()
     {
-        glCheck(glBindVertexArray(0));
+        GLState::bindVertexArray(0);
     }
 
     ///////////////////////////////////////////////////////////
@@ -119,7 +123,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void VertexArray::enableAttrib(QUInt32 location)
     {
-        glCheck(glEnableVertexAttribArray(location));
+        GLState::enableAttrib(m_Attribs, location);
     }
 
     ///////////////////////////////////////////////////////////
@@ -130,6 +134,6 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void VertexArray::disableAttrib(QUInt32 location)
     {
-        glCheck(glDisableVertexAttribArray(location));
+        GLState::disableAttrib(m_Attribs, location);
     }
 }
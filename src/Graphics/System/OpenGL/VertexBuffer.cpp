@@ -35,6 +35,7 @@
 //
 ///////////////////////////////////////////////////////////
 #include <Qube2D/Graphics/System/OpenGL/VertexBuffer.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
 #include <Qube2D/Debug/GLCheck.hpp>
 #include <glad/glad.h>
 
@@ -74,6 +75,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void VertexBuffer::destroy()
     {
+        GLState::forgetBuffer(m_ID);
         glCheck(glDeleteBuffers(1, &m_ID));
         m_ID = 0;
     }
@@ -99,7 +101,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void VertexBuffer::bind()
     {
-        glCheck(glBindBuffer(m_Type, m_ID));
+        GLState::bindBuffer(m_Type, m_ID);
     }
 
     ///////////////////////////////////////////////////////////
@@ -110,7 +112,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void VertexBuffer::unbind()
     {
-        glCheck(glBindBuffer(m_Type, 0));
+        GLState::bindBuffer(m_Type, 0);
     }
 
     ///////////////////////////////////////////////////////////
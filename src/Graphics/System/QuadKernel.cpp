@@ -0,0 +1,554 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/System/QuadKernel.hpp>
+#include <algorithm>
+
+
+///////////////////////////////////////////////////////////
+// SIMD support; MSVC accepts intrinsics without flags,
+// GCC and Clang need them enabled per function.
+//
+///////////////////////////////////////////////////////////
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define QUAD_KERNEL_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define QUAD_TARGET_SSE2
+        #define QUAD_TARGET_AVX2
+    #else
+        #define QUAD_TARGET_SSE2 __attribute__((target("sse2")))
+        #define QUAD_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define QUAD_FLOAT_ARRAYS   15
+    #define QUAD_COLOR_ARRAYS   4
+    #define QUAD_INV_255        (1.f / 255.f)
+
+    ///////////////////////////////////////////////////////////
+    // Local helpers
+    //
+    ///////////////////////////////////////////////////////////
+    namespace
+    {
+        ///////////////////////////////////////////////////////////
+        /// Packs the color of a vertex into RGBA8.
+        ///
+        ///////////////////////////////////////////////////////////
+        inline QUInt32 packColor(const TextureVertex &v)
+        {
+            const float *rgba = &v.r;
+            QUInt32 packed = 0;
+
+            for (int i = 0; i < 4; i++)
+            {
+                float c = std::min(std::max(rgba[i], 0.f), 1.f);
+                packed |= static_cast<QUInt32>(c * 255.f + .5f) << (i * 8);
+            }
+
+            return packed;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// Determines the widest instruction set of this CPU.
+        ///
+        ///////////////////////////////////////////////////////////
+        SimdLevel detectLevel()
+        {
+        #if defined(QUAD_KERNEL_X86)
+        #if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 0);
+            int maxLeaf = info[0];
+
+            __cpuid(info, 1);
+            bool sse2 = (info[3] & (1 << 26)) != 0;
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+
+            // AVX registers must be saved by the OS as well
+            if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6)
+            {
+                __cpuidex(info, 7, 0);
+                if ((info[1] & (1 << 5)) != 0)
+                    return SimdLevel::AVX2;
+            }
+
+            if (sse2)
+                return SimdLevel::SSE2;
+        #else
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+                return SimdLevel::AVX2;
+            if (__builtin_cpu_supports("sse2"))
+                return SimdLevel::SSE2;
+        #endif
+        #endif
+
+            return SimdLevel::Scalar;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// Transforms the quads [first, count) one by one.
+        ///
+        ///////////////////////////////////////////////////////////
+        void transformScalar(const QuadArrays &q,
+                             QUInt32 first,
+                             QUInt32 count,
+                             TextureVertices *out)
+        {
+            for (QUInt32 i = first; i < count; i++)
+            {
+                const float lx[4] = { q.left[i], q.right[i], q.right[i], q.left[i] };
+                const float ly[4] = { q.top[i], q.top[i], q.bottom[i], q.bottom[i] };
+                const float u[4] = { q.u0[i], q.u1[i], q.u1[i], q.u0[i] };
+                const float v[4] = { q.v0[i], q.v0[i], q.v1[i], q.v1[i] };
+                TextureVertex *dst = &out[i].v0;
+
+                for (int k = 0; k < 4; k++)
+                {
+                    QUInt32 color = q.colors[k][i];
+
+                    dst[k].x = (q.a[i] * lx[k] + q.c[i] * ly[k]) + q.tx[i];
+                    dst[k].y = (q.b[i] * lx[k] + q.d[i] * ly[k]) + q.ty[i];
+                    dst[k].u = u[k];
+                    dst[k].v = v[k];
+                    dst[k].r = static_cast<float>(color & 0xFF) * QUAD_INV_255;
+                    dst[k].g = static_cast<float>((color >> 8) & 0xFF) * QUAD_INV_255;
+                    dst[k].b = static_cast<float>((color >> 16) & 0xFF) * QUAD_INV_255;
+                    dst[k].a = static_cast<float>(color >> 24) * QUAD_INV_255 * q.opacity[i];
+                }
+            }
+        }
+
+    #if defined(QUAD_KERNEL_X86)
+
+        ///////////////////////////////////////////////////////////
+        /// Transforms four quads per iteration and returns the
+        /// index of the first quad left for the scalar loop.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUAD_TARGET_SSE2 QUInt32 transformSSE2(const QuadArrays &q,
+                                               QUInt32 count,
+                                               TextureVertices *out)
+        {
+            const __m128 inv = _mm_set1_ps(QUAD_INV_255);
+            const __m128i mask = _mm_set1_epi32(0xFF);
+            QUInt32 i = 0;
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 a = _mm_loadu_ps(q.a + i);
+                __m128 b = _mm_loadu_ps(q.b + i);
+                __m128 c = _mm_loadu_ps(q.c + i);
+                __m128 d = _mm_loadu_ps(q.d + i);
+                __m128 tx = _mm_loadu_ps(q.tx + i);
+                __m128 ty = _mm_loadu_ps(q.ty + i);
+                __m128 l = _mm_loadu_ps(q.left + i);
+                __m128 t = _mm_loadu_ps(q.top + i);
+                __m128 r = _mm_loadu_ps(q.right + i);
+                __m128 bt = _mm_loadu_ps(q.bottom + i);
+                __m128 u0 = _mm_loadu_ps(q.u0 + i);
+                __m128 v0 = _mm_loadu_ps(q.v0 + i);
+                __m128 u1 = _mm_loadu_ps(q.u1 + i);
+                __m128 v1 = _mm_loadu_ps(q.v1 + i);
+                __m128 op = _mm_loadu_ps(q.opacity + i);
+
+                // Products shared by two corners each
+                __m128 al = _mm_mul_ps(a, l), ar = _mm_mul_ps(a, r);
+                __m128 bl = _mm_mul_ps(b, l), br = _mm_mul_ps(b, r);
+                __m128 ct = _mm_mul_ps(c, t), cb = _mm_mul_ps(c, bt);
+                __m128 dt = _mm_mul_ps(d, t), db = _mm_mul_ps(d, bt);
+
+                __m128 xs[4] = {
+                    _mm_add_ps(_mm_add_ps(al, ct), tx),
+                    _mm_add_ps(_mm_add_ps(ar, ct), tx),
+                    _mm_add_ps(_mm_add_ps(ar, cb), tx),
+                    _mm_add_ps(_mm_add_ps(al, cb), tx)
+                };
+                __m128 ys[4] = {
+                    _mm_add_ps(_mm_add_ps(bl, dt), ty),
+                    _mm_add_ps(_mm_add_ps(br, dt), ty),
+                    _mm_add_ps(_mm_add_ps(br, db), ty),
+                    _mm_add_ps(_mm_add_ps(bl, db), ty)
+                };
+                __m128 us[4] = { u0, u1, u1, u0 };
+                __m128 vs[4] = { v0, v0, v1, v1 };
+
+                // Transposes the lanes into one vertex per quad
+                __m128 rows[4][8];
+                for (int k = 0; k < 4; k++)
+                {
+                    __m128i col = _mm_loadu_si128(reinterpret_cast<const __m128i *>(q.colors[k] + i));
+                    __m128 cr = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(col, mask)), inv);
+                    __m128 cg = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(col, 8), mask)), inv);
+                    __m128 cb2 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(col, 16), mask)), inv);
+                    __m128 ca = _mm_mul_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(col, 24)), inv), op);
+                    __m128 x = xs[k], y = ys[k], u = us[k], v = vs[k];
+
+                    _MM_TRANSPOSE4_PS(x, y, u, v);
+                    _MM_TRANSPOSE4_PS(cr, cg, cb2, ca);
+
+                    rows[k][0] = x;  rows[k][1] = cr;
+                    rows[k][2] = y;  rows[k][3] = cg;
+                    rows[k][4] = u;  rows[k][5] = cb2;
+                    rows[k][6] = v;  rows[k][7] = ca;
+                }
+
+                // Stores sequentially, which suits mapped memory
+                float *dst = &out[i].v0.x;
+                for (int j = 0; j < 4; j++)
+                {
+                    for (int k = 0; k < 4; k++)
+                    {
+                        _mm_storeu_ps(dst, rows[k][j * 2]);
+                        _mm_storeu_ps(dst + 4, rows[k][j * 2 + 1]);
+                        dst += 8;
+                    }
+                }
+            }
+
+            return i;
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// Transposes eight rows of eight floats.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUAD_TARGET_AVX2 inline void transpose8(__m256 *r)
+        {
+            __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]);
+            __m256 t1 = _mm256_unpackhi_ps(r[0], r[1]);
+            __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]);
+            __m256 t3 = _mm256_unpackhi_ps(r[2], r[3]);
+            __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]);
+            __m256 t5 = _mm256_unpackhi_ps(r[4], r[5]);
+            __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]);
+            __m256 t7 = _mm256_unpackhi_ps(r[6], r[7]);
+
+            __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+            __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+            __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+            __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+            r[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+            r[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+            r[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+            r[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+            r[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+            r[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+            r[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+            r[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+        }
+
+        ///////////////////////////////////////////////////////////
+        /// Transforms eight quads per iteration and returns the
+        /// index of the first quad left for the scalar loop.
+        ///
+        ///////////////////////////////////////////////////////////
+        QUAD_TARGET_AVX2 QUInt32 transformAVX2(const QuadArrays &q,
+                                               QUInt32 count,
+                                               TextureVertices *out)
+        {
+            const __m256 inv = _mm256_set1_ps(QUAD_INV_255);
+            const __m256i mask = _mm256_set1_epi32(0xFF);
+            QUInt32 i = 0;
+
+            for (; i + 8 <= count; i += 8)
+            {
+                __m256 a = _mm256_loadu_ps(q.a + i);
+                __m256 b = _mm256_loadu_ps(q.b + i);
+                __m256 c = _mm256_loadu_ps(q.c + i);
+                __m256 d = _mm256_loadu_ps(q.d + i);
+                __m256 tx = _mm256_loadu_ps(q.tx + i);
+                __m256 ty = _mm256_loadu_ps(q.ty + i);
+                __m256 l = _mm256_loadu_ps(q.left + i);
+                __m256 t = _mm256_loadu_ps(q.top + i);
+                __m256 r = _mm256_loadu_ps(q.right + i);
+                __m256 bt = _mm256_loadu_ps(q.bottom + i);
+                __m256 u0 = _mm256_loadu_ps(q.u0 + i);
+                __m256 v0 = _mm256_loadu_ps(q.v0 + i);
+                __m256 u1 = _mm256_loadu_ps(q.u1 + i);
+                __m256 v1 = _mm256_loadu_ps(q.v1 + i);
+                __m256 op = _mm256_loadu_ps(q.opacity + i);
+
+                // Products shared by two corners each; no FMA, so
+                // that the results equal the scalar loop.
+                __m256 al = _mm256_mul_ps(a, l), ar = _mm256_mul_ps(a, r);
+                __m256 bl = _mm256_mul_ps(b, l), br = _mm256_mul_ps(b, r);
+                __m256 ct = _mm256_mul_ps(c, t), cb = _mm256_mul_ps(c, bt);
+                __m256 dt = _mm256_mul_ps(d, t), db = _mm256_mul_ps(d, bt);
+
+                __m256 xs[4] = {
+                    _mm256_add_ps(_mm256_add_ps(al, ct), tx),
+                    _mm256_add_ps(_mm256_add_ps(ar, ct), tx),
+                    _mm256_add_ps(_mm256_add_ps(ar, cb), tx),
+                    _mm256_add_ps(_mm256_add_ps(al, cb), tx)
+                };
+                __m256 ys[4] = {
+                    _mm256_add_ps(_mm256_add_ps(bl, dt), ty),
+                    _mm256_add_ps(_mm256_add_ps(br, dt), ty),
+                    _mm256_add_ps(_mm256_add_ps(br, db), ty),
+                    _mm256_add_ps(_mm256_add_ps(bl, db), ty)
+                };
+                __m256 us[4] = { u0, u1, u1, u0 };
+                __m256 vs[4] = { v0, v0, v1, v1 };
+
+                // Transposes the lanes into one vertex per quad
+                __m256 rows[4][8];
+                for (int k = 0; k < 4; k++)
+                {
+                    __m256i col = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(q.colors[k] + i));
+
+                    rows[k][0] = xs[k];
+                    rows[k][1] = ys[k];
+                    rows[k][2] = us[k];
+                    rows[k][3] = vs[k];
+                    rows[k][4] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(col, mask)), inv);
+                    rows[k][5] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(col, 8), mask)), inv);
+                    rows[k][6] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(col, 16), mask)), inv);
+                    rows[k][7] = _mm256_mul_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(col, 24)), inv), op);
+
+                    transpose8(rows[k]);
+                }
+
+                // Stores sequentially, which suits mapped memory
+                float *dst = &out[i].v0.x;
+                for (int j = 0; j < 8; j++)
+                {
+                    for (int k = 0; k < 4; k++)
+                    {
+                        _mm256_storeu_ps(dst, rows[k][j]);
+                        dst += 8;
+                    }
+                }
+            }
+
+            return i;
+        }
+
+    #endif
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    QuadList::QuadList()
+        : m_Capacity(0)
+    {
+        resize(0);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      resize
+    ///
+    ///////////////////////////////////////////////////////////
+    void QuadList::resize(QUInt32 capacity)
+    {
+        // One extra element keeps the pointers valid if empty
+        QUInt32 stride = capacity + 1;
+        m_Floats.assign(stride * QUAD_FLOAT_ARRAYS, 0.f);
+        m_Colors.assign(stride * QUAD_COLOR_ARRAYS, 0);
+        m_Capacity = capacity;
+
+        const float *f = m_Floats.data();
+        m_Arrays.a       = f + stride * 0;
+        m_Arrays.b       = f + stride * 1;
+        m_Arrays.c       = f + stride * 2;
+        m_Arrays.d       = f + stride * 3;
+        m_Arrays.tx      = f + stride * 4;
+        m_Arrays.ty      = f + stride * 5;
+        m_Arrays.left    = f + stride * 6;
+        m_Arrays.top     = f + stride * 7;
+        m_Arrays.right   = f + stride * 8;
+        m_Arrays.bottom  = f + stride * 9;
+        m_Arrays.u0      = f + stride * 10;
+        m_Arrays.v0      = f + stride * 11;
+        m_Arrays.u1      = f + stride * 12;
+        m_Arrays.v1      = f + stride * 13;
+        m_Arrays.opacity = f + stride * 14;
+
+        for (QUInt32 k = 0; k < QUAD_COLOR_ARRAYS; k++)
+            m_Arrays.colors[k] = m_Colors.data() + stride * k;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      clear
+    ///
+    ///////////////////////////////////////////////////////////
+    void QuadList::clear()
+    {
+        resize(0);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      set
+    ///
+    ///////////////////////////////////////////////////////////
+    void QuadList::set(QUInt32 index,
+                       const Transform &transform,
+                       const TextureVertices &quad,
+                       QFloat opacity)
+    {
+        // The arrays are owned by this list; the view is const
+        // merely to protect them from the kernel.
+        QUInt32 stride = m_Capacity + 1;
+        float *f = m_Floats.data() + index;
+        QUInt32 *c = m_Colors.data() + index;
+
+        f[stride * 0]  = transform.a;
+        f[stride * 1]  = transform.b;
+        f[stride * 2]  = transform.c;
+        f[stride * 3]  = transform.d;
+        f[stride * 4]  = transform.tx;
+        f[stride * 5]  = transform.ty;
+        f[stride * 6]  = quad.v0.x;
+        f[stride * 7]  = quad.v0.y;
+        f[stride * 8]  = quad.v2.x;
+        f[stride * 9]  = quad.v2.y;
+        f[stride * 10] = quad.v0.u;
+        f[stride * 11] = quad.v0.v;
+        f[stride * 12] = quad.v2.u;
+        f[stride * 13] = quad.v2.v;
+        f[stride * 14] = opacity;
+
+        c[stride * 0] = packColor(quad.v0);
+        c[stride * 1] = packColor(quad.v1);
+        c[stride * 2] = packColor(quad.v2);
+        c[stride * 3] = packColor(quad.v3);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      arrays -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    const QuadArrays &QuadList::arrays() const
+    {
+        return m_Arrays;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      capacity -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 QuadList::capacity() const
+    {
+        return m_Capacity;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      transform -> static
+    ///
+    ///////////////////////////////////////////////////////////
+    void QuadKernel::transform(const QuadArrays &quads,
+                               QUInt32 count,
+                               TextureVertices *out)
+    {
+        transform(quads, count, out, simdLevel());
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      transform -> static
+    ///
+    ///////////////////////////////////////////////////////////
+    void QuadKernel::transform(const QuadArrays &quads,
+                               QUInt32 count,
+                               TextureVertices *out,
+                               SimdLevel level)
+    {
+        QUInt32 done = 0;
+        if (level > simdLevel())
+            level = simdLevel();
+
+    #if defined(QUAD_KERNEL_X86)
+        if (level == SimdLevel::AVX2)
+            done = transformAVX2(quads, count, out);
+        else if (level == SimdLevel::SSE2)
+            done = transformSSE2(quads, count, out);
+    #endif
+
+        // Transforms the remaining quads
+        transformScalar(quads, done, count, out);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      simdLevel -> static
+    ///
+    ///////////////////////////////////////////////////////////
+    SimdLevel QuadKernel::simdLevel()
+    {
+        static const SimdLevel level = detectLevel();
+        return level;
+    }
+}
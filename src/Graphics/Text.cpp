@@ -37,10 +37,12 @@
 #include <Qube2D/System/Structs/GLColor.hpp>
 #include <Qube2D/Graphics/System/Shader/TextShaders.hpp>
 #include <Qube2D/Graphics/Text.hpp>
+#include <Qube2D/Graphics/System/Culling.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
 #include <Qube2D/Debug/GLCheck.hpp>
 #include <Qube2D/Debug/Debug.hpp>
-#include <glm/gtc/matrix_transform.hpp>
 #include <glad/glad.h>
+#include <algorithm>
 #include <fstream>
 #include <cmath>
 
@@ -53,7 +55,33 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     #define TEXT_SINGLE_VERTEX     sizeof(float) * 4
     #define TEXT_OFFSET_COORD      (const void *)(sizeof(float) * 2)
-    inline void Qube2D_Text_Add_Line(std::vector<float> &v, const RectF &bounds);
+    #define TEXT_QUAD_FLOATS       16
+    #define TEXT_QUAD_INDICES      6
+    #define TEXT_MAX_QUADS         16384
+    #define TEXT_SDF_EDGE          0.5f
+    #define TEXT_SDF_MIN_EDGE      0.02f
+    #define TEXT_SDF_SOFTNESS      0.1f
+    #define TEXT_LAYOUT_ATTEMPTS   2
+    inline float *Qube2D_Text_Add_Quad(float *v, QFloat x, QFloat y, QFloat w, QFloat h,
+                                       QFloat u, QFloat t0, QFloat s, QFloat t);
+    inline float *Qube2D_Text_Add_Line(float *v, const RectF &bounds);
+
+
+    ///////////////////////////////////////////////////////////
+    /// \struct  TextCursor
+    /// \brief   Pen and write positions while laying out text.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct TextCursor
+    {
+        float *fill;            ///< Next regular quad
+        float *outline;         ///< Next outline quad
+        float *shadow;          ///< Next drop shadow quad
+        const float *first;     ///< First regular quad of the text
+        QFloat x;               ///< Horizontal pen position
+        QFloat y;               ///< Vertical pen position
+        char32_t prev;          ///< Last glyph, for kerning
+    };
 
 
     ///////////////////////////////////////////////////////////
@@ -61,6 +89,7 @@ namespace Qube2D
     //
     ///////////////////////////////////////////////////////////
     VertexArray Text::m_VertexArray;
+    VertexBuffer Text::m_IndexBuffer;
     ShaderProgram Text::m_ShaderProgram;
     Shader Text::m_VertexShader;
     Shader Text::m_FragShader;
@@ -68,6 +97,7 @@ namespace Qube2D
     QInt32 Text::m_UniformMatrix;
     QInt32 Text::m_UniformOpacity;
     QInt32 Text::m_UniformColor;
+    QInt32 Text::m_UniformEdge;
 
 
     ///////////////////////////////////////////////////////////
@@ -80,9 +110,26 @@ namespace Qube2D
         : IFadable(),
           IMovable(),
           ITransformable(),
+          ISpatial(),
           m_Font(NULL),
-          m_VertexCount(0),
-          m_OutlineWidth(0.f)
+          m_Page(0),
+          m_Generation(0),
+          m_Stamp(0),
+          m_BufferSize(0),
+          m_QuadCount(0),
+          m_OutlineQuadCount(0),
+          m_ShadowQuadCount(0),
+          m_Size(0),
+          m_Style(TextStyle::Regular),
+          m_OutlineWidth(0.f),
+          m_LineWidth(0.f),
+          m_ShadowX(0.f),
+          m_ShadowY(0.f),
+          m_LocalBounds(0.f, 0.f, 0.f, 0.f),
+          m_GlyphScale(1.f),
+          m_DistanceField(false),
+          m_Incremental(false),
+          m_LayoutValid(false)
     {
     }
 
@@ -97,6 +144,7 @@ namespace Qube2D
     {
         m_VertexBuffer.create(BufferType::Vertex,
                               BufferUsage::Dynamic);
+        m_BufferSize = 0;
     }
 
     ///////////////////////////////////////////////////////////
@@ -108,6 +156,7 @@ namespace Qube2D
     void Text::destroy()
     {
         m_VertexBuffer.destroy();
+        leaveIndex();
     }
 
 
@@ -142,6 +191,7 @@ namespace Qube2D
     void Text::setOutlineWidth(QFloat width)
     {
         m_OutlineWidth = width;
+        m_LayoutValid = false;
         m_Font->setOutlineWidth(width);
     }
 
@@ -166,6 +216,7 @@ namespace Qube2D
     {
         m_ShadowX = x;
         m_ShadowY = y;
+        m_LayoutValid = false;
     }
 
     ///////////////////////////////////////////////////////////
@@ -178,6 +229,7 @@ namespace Qube2D
     {
         assert(font);
         m_Font = font;
+        m_LayoutValid = false;
     }
 
     ///////////////////////////////////////////////////////////
@@ -189,6 +241,7 @@ namespace Qube2D
     void Text::setTextSize(QUInt32 size)
     {
         m_Size = size;
+        m_LayoutValid = false;
     }
 
     ///////////////////////////////////////////////////////////
@@ -202,48 +255,298 @@ namespace Qube2D
         assert(!text.isEmpty());
         assert(m_Font);
 
+        // Counters mostly change a few characters at their end
+        if (m_LayoutValid && style == m_Style && relayout(text))
+            return;
 
+        m_Text = text;
+        m_Style = style;
+        if (!restore())
+            layout();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      setIncremental
+    ///
+    ///////////////////////////////////////////////////////////
+    void Text::setIncremental(QBool enabled)
+    {
+        m_Incremental = enabled;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      refresh
+    ///
+    ///////////////////////////////////////////////////////////
+    void Text::refresh()
+    {
+        if (m_Font == NULL || m_Text.isEmpty())
+            return;
+
+        // Evicted glyphs may have been overwritten by others
+        if (m_Font->generation(m_Page) != m_Generation)
+            layout();
+
+        // Keeps the glyphs in use; only needed once per clock, since
+        // glyphs stamped with the current one are never evicted
+        if (m_Font->clock() != m_Stamp)
+        {
+            m_Font->touch(m_Text, m_Size, m_Style, m_DistanceField);
+            m_Stamp = m_Font->clock();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      layout
+    ///
+    ///////////////////////////////////////////////////////////
+    void Text::layout()
+    {
+        // Evicting makes room for the glyphs of this text, thus
+        // the repeated layout finds all of them cached
+        QBool complete = false;
+        for (QUInt32 i = 0; i < TEXT_LAYOUT_ATTEMPTS && !complete; ++i)
+            complete = layoutOnce();
+
+        m_Page = m_Font->page();
+        m_Generation = m_Font->generation(m_Page);
+        m_Stamp = m_Font->clock();
+        m_LayoutValid = true;
+        updateBounds();
+        upload();
+
+        // Shares the quads with other texts showing the same string;
+        // incremental texts rarely show the same string twice
+        TextLayout *cached;
+        if (complete && !m_Incremental && (cached = m_Font->layouts().insert(layoutKey())) != NULL)
+        {
+            float *base = m_Staging.data();
+            cached->vertices.assign(base, base + (m_QuadCount + m_OutlineQuadCount + m_ShadowQuadCount) * TEXT_QUAD_FLOATS);
+            cached->quadCount = m_QuadCount;
+            cached->outlineQuadCount = m_OutlineQuadCount;
+            cached->shadowQuadCount = m_ShadowQuadCount;
+            cached->page = m_Page;
+            cached->generation = m_Generation;
+            cached->glyphScale = m_GlyphScale;
+            cached->bounds = m_LocalBounds;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      layoutKey -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    TextLayoutKey Text::layoutKey() const
+    {
+        return { &m_Text, m_Size, m_Style, m_OutlineWidth, m_LineWidth,
+                 m_ShadowX, m_ShadowY, m_Font->isDistanceField(), false };
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      restore
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Text::restore()
+    {
+        const TextLayout *cached = m_Font->layouts().find(layoutKey());
+        if (cached == NULL || m_Font->generation(cached->page) != cached->generation)
+            return false;
+
+        if (m_Staging.size() < cached->vertices.size())
+            m_Staging.resize(cached->vertices.size());
+
+        std::copy(cached->vertices.begin(), cached->vertices.end(), m_Staging.begin());
+        m_QuadCount = cached->quadCount;
+        m_OutlineQuadCount = cached->outlineQuadCount;
+        m_ShadowQuadCount = cached->shadowQuadCount;
+        m_Page = cached->page;
+        m_Generation = cached->generation;
+        m_GlyphScale = cached->glyphScale;
+        m_DistanceField = m_Font->isDistanceField();
+        m_LocalBounds = cached->bounds;
+
+        // The per-character records of relayout were not cached
+        m_LayoutValid = false;
+        boundsChanged();
+        upload();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      upload
+    ///
+    ///////////////////////////////////////////////////////////
+    void Text::upload()
+    {
+        // Overwrites the buffer in place if the data still fits
+        float *base = m_Staging.data();
+        QUInt32 size = (m_QuadCount + m_OutlineQuadCount + m_ShadowQuadCount) * TEXT_QUAD_FLOATS * sizeof(float);
+        m_VertexBuffer.bind();
+        if (size <= m_BufferSize)
+        {
+            m_VertexBuffer.modify(base, 0, 0, size);
+        }
+        else
+        {
+            m_VertexBuffer.fill(base, size);
+            m_BufferSize = size;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      updateBounds
+    ///
+    ///////////////////////////////////////////////////////////
+    void Text::updateBounds()
+    {
+        // Determines the local hull for culling
+        float *base = m_Staging.data();
+        float *end = base + (m_QuadCount + m_OutlineQuadCount + m_ShadowQuadCount) * TEXT_QUAD_FLOATS;
+        float minX = 0.f, minY = 0.f, maxX = 0.f, maxY = 0.f;
+        for (float *it = base; it < end; it += 4)
+        {
+            float vx = it[0], vy = it[1];
+            if (it == base || vx < minX) minX = vx;
+            if (it == base || vx > maxX) maxX = vx;
+            if (it == base || vy < minY) minY = vy;
+            if (it == base || vy > maxY) maxY = vy;
+        }
+
+        m_LocalBounds = RectF(minX, minY, maxX - minX, maxY - minY);
+        boundsChanged();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      layoutOnce
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Text::layoutOnce()
+    {
         // Prepares all glyphs of given size
+        const String &text = m_Text;
+        TextStyle style = m_Style;
         m_Font->extract(m_Size);
-        m_OutlineVertexCount = 0;
-        m_VertexCount = 0;
-        m_Style = style;
 
+        QUInt32 page = m_Font->page();
+        QUInt32 generation = m_Font->generation(page);
 
-        // Removes the outline bit from the field
-        TextStyle regular = style & ~TextStyle::Outline;
-        std::vector<float> vertices, outlineVertices, shadowVertices;
-        char32_t prevChar = 0;
+        // Distance field metrics are scaled to the requested size
+        m_DistanceField = m_Font->isDistanceField();
+        m_GlyphScale = m_Font->scale();
+
+        // Every character yields at most one glyph quad per pass; a new-line
+        // may yield both an underline and a strikethrough quad instead.
+        QUInt32 length = text.length();
+        QUInt32 regularMax = length * 2 + 2;
+        QUInt32 outlineMax = (style & TextStyle::Outline) ? length : 0;
+        QUInt32 shadowMax = (style & TextStyle::DropShadow) ? length : 0;
+        std::size_t required = (regularMax + outlineMax + shadowMax) * TEXT_QUAD_FLOATS;
+
+        // Grows the staging area only if the text does not fit anymore
+        if (m_Staging.size() < required)
+            m_Staging.resize(required);
+
+        m_CharQuads.resize(length + 1);
+        m_CharPens.resize((length + 1) * 2);
+
+        float *base = m_Staging.data();
+        float *outlineBegin = base + regularMax * TEXT_QUAD_FLOATS;
+        float *shadowBegin = outlineBegin + outlineMax * TEXT_QUAD_FLOATS;
+
+        TextCursor cursor;
+        cursor.fill = base;
+        cursor.outline = outlineBegin;
+        cursor.shadow = shadowBegin;
+        cursor.first = base;
+        cursor.x = 0.f;
+        cursor.y = 0.f;
+        cursor.prev = 0;
+        layoutSpan(text, 0, length, cursor);
+
+        // Places the strike-through at half the single-line height
+        QUInt32 strikeY = (m_Size * (72.f / 96.f)) / 2.f;
+        QFloat sp_line = m_Font->lineSpacing();
+
+        if (style & TextStyle::Underline)
+            cursor.fill = Qube2D_Text_Add_Line(cursor.fill, { 0, cursor.y + sp_line, cursor.x, m_LineWidth });
+        if (style & TextStyle::Strikethrough)
+            cursor.fill = Qube2D_Text_Add_Line(cursor.fill, { 0, cursor.y + strikeY, cursor.x, m_LineWidth });
+
+
+        // Dynamically determines the quad count
+        m_QuadCount = (cursor.fill - base) / TEXT_QUAD_FLOATS;
+        m_OutlineQuadCount = (cursor.outline - outlineBegin) / TEXT_QUAD_FLOATS;
+        m_ShadowQuadCount = (cursor.shadow - shadowBegin) / TEXT_QUAD_FLOATS;
+
+        // Closes the gaps between the regions, in place
+        float *end = std::copy(outlineBegin, cursor.outline, cursor.fill);
+        std::copy(shadowBegin, cursor.shadow, end);
+
+        return m_Font->generation(page) == generation;
+    }
 
-        // Determines strike-through location with character 'x'
-        QUInt32 strikeY = m_Font->measureString(U"x", regular, m_Size).height() / 2.f;
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      layoutSpan
+    ///
+    ///////////////////////////////////////////////////////////
+    void Text::layoutSpan(const String &text, QUInt32 begin, QUInt32 end, TextCursor &cursor)
+    {
+        TextStyle style = m_Style;
+        QFloat k = m_GlyphScale;
 
+        // Removes the outline bit from the field
+        TextStyle regular = style & ~TextStyle::Outline;
 
-        // Pre-computes the advance offset of a whitespace
-        if (!m_Font->isCached(U' ', regular))
-            m_Font->cacheGlyph(U' ', regular);
+        // Places the strike-through at half the single-line height
+        QUInt32 strikeY = (m_Size * (72.f / 96.f)) / 2.f;
 
 
         // Retrieves miscellaneous values for the iteration
-        QFloat wsAdvance = m_Font->glyph(U' ', regular).advance;
-        QUInt32 length = text.length();
+        QFloat wsAdvance = m_Font->fetch(U' ', regular).advance * k;
         QFloat sp_line = m_Font->lineSpacing();
-        QFloat pos_x = 0, pos_y = 0;
+        QFloat pos_x = cursor.x, pos_y = cursor.y;
+        char32_t prevChar = cursor.prev;
+        float *vertices = cursor.fill;
+        float *outlineVertices = cursor.outline;
+        float *shadowVertices = cursor.shadow;
 
 
         // Generates the "outline" vertices
-        for (QUInt32 i = 0; i < length; ++i)
+        for (QUInt32 i = begin; i < end; ++i)
         {
             char32_t c = text.at(i);
 
+            // Remembers where the character starts for relayout
+            m_CharQuads[i] = (vertices - cursor.first) / TEXT_QUAD_FLOATS;
+            m_CharPens[i * 2] = pos_x;
+            m_CharPens[i * 2 + 1] = pos_y;
+
             // Changes the vertical position on new-line
             if (c == '\n')
             {
                 // Add underline & strikethrough for this line
                 if (style & TextStyle::Underline)
-                    Qube2D_Text_Add_Line(vertices, { 0, pos_y + sp_line, pos_x, m_LineWidth });
+                    vertices = Qube2D_Text_Add_Line(vertices, { 0, pos_y + sp_line, pos_x, m_LineWidth });
                 if (style & TextStyle::Strikethrough)
-                    Qube2D_Text_Add_Line(vertices, { 0, pos_y + strikeY, pos_x, m_LineWidth });
+                    vertices = Qube2D_Text_Add_Line(vertices, { 0, pos_y + strikeY, pos_x, m_LineWidth });
 
                 // Increment Y pos
                 pos_y += sp_line;
@@ -269,100 +572,263 @@ namespace Qube2D
             // Adds the outline vertices
             if (style & TextStyle::Outline)
             {
-                // Caches the glyph, if not already
-                if (!m_Font->isCached(c, style))
-                    m_Font->cacheGlyph(c, style);
-
-                // Generates the vertex data
-                const Glyph &glyph = m_Font->glyph(c, style);
-                QFloat x = pos_x + glyph.bearing_x - m_OutlineWidth, w = x + glyph.glyph_w;
-                QFloat y = pos_y + glyph.bearing_y - m_OutlineWidth, h = y + glyph.glyph_h;
+                // Generates the vertex data; caches the glyph, if not already.
+                // Distance fields are padded and grown by the shader instead.
+                const Glyph &glyph = m_Font->fetch(c, style);
+                QFloat shift = m_DistanceField ? 0.f : m_OutlineWidth;
+                QFloat x = pos_x + glyph.bearing_x * k - shift, w = x + glyph.glyph_w * k;
+                QFloat y = pos_y + glyph.bearing_y * k - shift, h = y + glyph.glyph_h * k;
                 QFloat u = glyph.texture_x, v = glyph.texture_y;
                 QFloat s = u + glyph.texture_w, t = v + glyph.texture_h;
 
-                outlineVertices.push_back(x); outlineVertices.push_back(y);
-                outlineVertices.push_back(u); outlineVertices.push_back(v);
-                outlineVertices.push_back(w); outlineVertices.push_back(y);
-                outlineVertices.push_back(s); outlineVertices.push_back(v);
-                outlineVertices.push_back(x); outlineVertices.push_back(h);
-                outlineVertices.push_back(u); outlineVertices.push_back(t);
-                outlineVertices.push_back(x); outlineVertices.push_back(h);
-                outlineVertices.push_back(u); outlineVertices.push_back(t);
-                outlineVertices.push_back(w); outlineVertices.push_back(y);
-                outlineVertices.push_back(s); outlineVertices.push_back(v);
-                outlineVertices.push_back(w); outlineVertices.push_back(h);
-                outlineVertices.push_back(s); outlineVertices.push_back(t);
+                outlineVertices = Qube2D_Text_Add_Quad(outlineVertices, x, y, w, h, u, v, s, t);
             }
 
 
             // Retrieves the regular glyph and its boundaries
-            if (!m_Font->isCached(c, regular))
-                m_Font->cacheGlyph(c, regular);
-
-            const Glyph &glyph = m_Font->glyph(c, regular);
-            QFloat x = pos_x + glyph.bearing_x, w = x + glyph.glyph_w;
-            QFloat y = pos_y + glyph.bearing_y, h = y + glyph.glyph_h;
+            const Glyph &glyph = m_Font->fetch(c, regular);
+            QFloat x = pos_x + glyph.bearing_x * k, w = x + glyph.glyph_w * k;
+            QFloat y = pos_y + glyph.bearing_y * k, h = y + glyph.glyph_h * k;
             QFloat u = glyph.texture_x, v = glyph.texture_y;
             QFloat s = u + glyph.texture_w, t = v + glyph.texture_h;
 
             // Adds the drop shadow vertices
             if (style & TextStyle::DropShadow)
             {
-                QFloat dx = x + m_ShadowX, dw = w + m_ShadowX;
-                QFloat dy = y + m_ShadowY, dh = h + m_ShadowY;
-
-                shadowVertices.push_back(dx); shadowVertices.push_back(dy);
-                shadowVertices.push_back(u);  shadowVertices.push_back(v);
-                shadowVertices.push_back(dw); shadowVertices.push_back(dy);
-                shadowVertices.push_back(s);  shadowVertices.push_back(v);
-                shadowVertices.push_back(dx); shadowVertices.push_back(dh);
-                shadowVertices.push_back(u);  shadowVertices.push_back(t);
-                shadowVertices.push_back(dx); shadowVertices.push_back(dh);
-                shadowVertices.push_back(u);  shadowVertices.push_back(t);
-                shadowVertices.push_back(dw); shadowVertices.push_back(dy);
-                shadowVertices.push_back(s);  shadowVertices.push_back(v);
-                shadowVertices.push_back(dw); shadowVertices.push_back(dh);
-                shadowVertices.push_back(s);  shadowVertices.push_back(t);
+                shadowVertices = Qube2D_Text_Add_Quad(shadowVertices,
+                                                      x + m_ShadowX, y + m_ShadowY,
+                                                      w + m_ShadowX, h + m_ShadowY,
+                                                      u, v, s, t);
             }
 
-
             // Adds the normal glyph vertices
-            vertices.push_back(x); vertices.push_back(y);
-            vertices.push_back(u); vertices.push_back(v);
-            vertices.push_back(w); vertices.push_back(y);
-            vertices.push_back(s); vertices.push_back(v);
-            vertices.push_back(x); vertices.push_back(h);
-            vertices.push_back(u); vertices.push_back(t);
-            vertices.push_back(x); vertices.push_back(h);
-            vertices.push_back(u); vertices.push_back(t);
-            vertices.push_back(w); vertices.push_back(y);
-            vertices.push_back(s); vertices.push_back(v);
-            vertices.push_back(w); vertices.push_back(h);
-            vertices.push_back(s); vertices.push_back(t);
-
-            pos_x += glyph.advance;
-            pos_x += m_Font->kerning(prevChar, c);
+            vertices = Qube2D_Text_Add_Quad(vertices, x, y, w, h, u, v, s, t);
+
+            pos_x += glyph.advance * k;
+            pos_x += m_Font->kerning(prevChar, c) * k;
+
+            // Stroked bitmap glyphs include the width in their advance
+            if (m_DistanceField && (regular & TextStyle::Bold || regular & TextStyle::OutlineOnly))
+                pos_x += m_OutlineWidth;
+
             prevChar = c;
         }
 
-        if (style & TextStyle::Underline)
-            Qube2D_Text_Add_Line(vertices, { 0, pos_y + sp_line, pos_x, m_LineWidth });
-        if (style & TextStyle::Strikethrough)
-            Qube2D_Text_Add_Line(vertices, { 0, pos_y + strikeY, pos_x, m_LineWidth });
+        m_CharQuads[end] = (vertices - cursor.first) / TEXT_QUAD_FLOATS;
+        m_CharPens[end * 2] = pos_x;
+        m_CharPens[end * 2 + 1] = pos_y;
 
+        cursor.fill = vertices;
+        cursor.outline = outlineVertices;
+        cursor.shadow = shadowVertices;
+        cursor.x = pos_x;
+        cursor.y = pos_y;
+        cursor.prev = prevChar;
+    }
 
-        // Dynamically determines the vertex count
-        m_OutlineVertexCount = outlineVertices.size() / 4;
-        m_ShadowVertexCount = shadowVertices.size() / 4;
-        m_VertexCount = vertices.size() / 4;
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      relayout
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Text::relayout(const String &text)
+    {
+        // Lines span entire rows and cannot be patched per character
+        if (!m_Incremental || !m_LayoutValid || m_Text.isEmpty() ||
+             m_Style & TextStyle::Underline || m_Style & TextStyle::Strikethrough)
+            return false;
+
+        m_Font->extract(m_Size);
+        if (m_Font->page() != m_Page || m_Font->generation(m_Page) != m_Generation ||
+            m_Font->isDistanceField() != m_DistanceField || m_Font->scale() != m_GlyphScale)
+            return false;
+
+
+        // Finds the common beginning and end of both texts
+        QUInt32 oldLength = m_Text.length(), newLength = text.length();
+        QUInt32 prefix = 0, suffix = 0;
+        while (prefix < oldLength && prefix < newLength && m_Text.at(prefix) == text.at(prefix))
+            prefix++;
+        if (prefix == oldLength && prefix == newLength)
+            return true;
+        while (suffix < oldLength - prefix && suffix < newLength - prefix &&
+               m_Text.at(oldLength - suffix - 1) == text.at(newLength - suffix - 1))
+            suffix++;
+
+        // The first glyph of the end is kerned against the changed span
+        while (suffix > 0)
+        {
+            char32_t c = text.at(newLength - suffix);
+            suffix--;
+
+            if (c != '\n' && c != ' ' && c != '\t')
+                break;
+        }
+
+        // Kerning continues from the last glyph of the beginning
+        char32_t prevChar = 0;
+        for (QUInt32 i = prefix; i > 0; --i)
+        {
+            char32_t c = m_Text.at(i - 1);
+            if (c != '\n' && c != ' ' && c != '\t')
+            {
+                prevChar = c;
+                break;
+            }
+        }
+
+
+        QUInt32 oldEnd = oldLength - suffix, newEnd = newLength - suffix;
+        QUInt32 count = m_QuadCount;
+        QUInt32 first = m_CharQuads[prefix], last = m_CharQuads[oldEnd];
+        QFloat startX = m_CharPens[prefix * 2], startY = m_CharPens[prefix * 2 + 1];
+        QFloat oldX = m_CharPens[oldEnd * 2], oldY = m_CharPens[oldEnd * 2 + 1];
+
+        // Moves the records of the unchanged end to their new indices
+        if (newEnd > oldEnd)
+        {
+            m_CharQuads.resize(newLength + 1);
+            m_CharPens.resize((newLength + 1) * 2);
+            std::copy_backward(m_CharQuads.begin() + oldEnd, m_CharQuads.begin() + oldLength + 1, m_CharQuads.end());
+            std::copy_backward(m_CharPens.begin() + oldEnd * 2, m_CharPens.begin() + (oldLength + 1) * 2, m_CharPens.end());
+        }
+        else if (newEnd < oldEnd)
+        {
+            std::copy(m_CharQuads.begin() + oldEnd, m_CharQuads.end(), m_CharQuads.begin() + newEnd);
+            std::copy(m_CharPens.begin() + oldEnd * 2, m_CharPens.end(), m_CharPens.begin() + newEnd * 2);
+            m_CharQuads.resize(newLength + 1);
+            m_CharPens.resize((newLength + 1) * 2);
+        }
+
+
+        // Reserves one region per pass, compacted afterwards
+        QBool outlined = m_Style & TextStyle::Outline;
+        QBool shadowed = m_Style & TextStyle::DropShadow;
+        QUInt32 regions = 1 + (outlined ? 1 : 0) + (shadowed ? 1 : 0);
+        QUInt32 maxCount = count - (last - first) + (newEnd - prefix);
+        std::size_t required = maxCount * regions * TEXT_QUAD_FLOATS;
+        if (m_Scratch.size() < required)
+            m_Scratch.resize(required);
+
+        const float *oldFill = m_Staging.data();
+        const float *oldOutline = oldFill + count * TEXT_QUAD_FLOATS;
+        const float *oldShadow = oldOutline + (outlined ? count : 0) * TEXT_QUAD_FLOATS;
+        float *fillBegin = m_Scratch.data();
+        float *outlineBegin = fillBegin + maxCount * TEXT_QUAD_FLOATS;
+        float *shadowBegin = outlineBegin + (outlined ? maxCount : 0) * TEXT_QUAD_FLOATS;
+
+        // Takes over the quads of the unchanged beginning
+        TextCursor cursor;
+        cursor.fill = std::copy(oldFill, oldFill + first * TEXT_QUAD_FLOATS, fillBegin);
+        cursor.outline = outlined ? std::copy(oldOutline, oldOutline + first * TEXT_QUAD_FLOATS, outlineBegin) : outlineBegin;
+        cursor.shadow = shadowed ? std::copy(oldShadow, oldShadow + first * TEXT_QUAD_FLOATS, shadowBegin) : shadowBegin;
+        cursor.first = fillBegin;
+        cursor.x = startX;
+        cursor.y = startY;
+        cursor.prev = prevChar;
+
+        // Fetching new glyphs may evict those of the unchanged parts
+        QUInt32 generation = m_Font->generation(m_Page);
+        layoutSpan(text, prefix, newEnd, cursor);
+        if (m_Font->generation(m_Page) != generation)
+            return false;
+
+
+        // Moves the unchanged end behind the changed span; only the
+        // line the span ended on moves horizontally as well
+        QUInt32 spanEnd = (cursor.fill - fillBegin) / TEXT_QUAD_FLOATS;
+        QUInt32 newCount = spanEnd + (count - last);
+        QUInt32 lineEnd = count;
+        QFloat dx = cursor.x - oldX, dy = cursor.y - oldY;
+        QBool sameLine = true;
+        for (QUInt32 i = newEnd; i <= newLength; ++i)
+        {
+            // The record at the end of the span is already up to date
+            if (i > newEnd)
+            {
+                m_CharPens[i * 2] += sameLine ? dx : 0.f;
+                m_CharPens[i * 2 + 1] += dy;
+                m_CharQuads[i] = m_CharQuads[i] - last + spanEnd;
+            }
+
+            if (sameLine && i < newLength && text.at(i) == '\n')
+            {
+                lineEnd = m_CharQuads[i] - spanEnd + last;
+                sameLine = false;
+            }
+        }
 
-        // Combines all the vertices into one buffer
-        vertices.insert(vertices.end(), outlineVertices.begin(), outlineVertices.end());
-        vertices.insert(vertices.end(), shadowVertices.begin(), shadowVertices.end());
+        const float *sources[] = { oldFill, oldOutline, oldShadow };
+        float *targets[] = { cursor.fill, cursor.outline, cursor.shadow };
+        QBool enabled[] = { true, outlined, shadowed };
+        for (QUInt32 r = 0; r < 3; ++r)
+        {
+            if (!enabled[r])
+                continue;
+
+            const float *src = sources[r] + last * TEXT_QUAD_FLOATS;
+            float *dst = targets[r];
+            for (QUInt32 q = last; q < count; ++q)
+            {
+                QFloat offsetX = (q < lineEnd) ? dx : 0.f;
+                for (QUInt32 v = 0; v < TEXT_QUAD_FLOATS; v += 4)
+                {
+                    dst[v + 0] = src[v + 0] + offsetX;
+                    dst[v + 1] = src[v + 1] + dy;
+                    dst[v + 2] = src[v + 2];
+                    dst[v + 3] = src[v + 3];
+                }
+
+                src += TEXT_QUAD_FLOATS;
+                dst += TEXT_QUAD_FLOATS;
+            }
+        }
+
+        // Closes the gaps between the regions, in place
+        float *end = std::copy(outlineBegin, outlineBegin + (outlined ? newCount : 0) * TEXT_QUAD_FLOATS,
+                               fillBegin + newCount * TEXT_QUAD_FLOATS);
+        std::copy(shadowBegin, shadowBegin + (shadowed ? newCount : 0) * TEXT_QUAD_FLOATS, end);
 
-        // Buffers the generated data
+        m_Staging.swap(m_Scratch);
+        m_Text = text;
+        m_QuadCount = newCount;
+        m_OutlineQuadCount = outlined ? newCount : 0;
+        m_ShadowQuadCount = shadowed ? newCount : 0;
+        updateBounds();
+
+
+        // Uploads only the quads that were generated or moved
+        float *base = m_Staging.data();
+        QUInt32 quadSize = TEXT_QUAD_FLOATS * sizeof(float);
+        QUInt32 size = newCount * regions * quadSize;
         m_VertexBuffer.bind();
-        m_VertexBuffer.fill(vertices.data(), vertices.size() * sizeof(float));
+        if (newCount == count)
+        {
+            QUInt32 changed = spanEnd;
+            if (dy != 0.f)
+                changed = newCount;
+            else if (dx != 0.f)
+                changed = lineEnd - last + spanEnd;
+
+            for (QUInt32 r = 0; r < regions && changed > first; ++r)
+            {
+                QUInt32 offset = (r * newCount + first) * quadSize;
+                m_VertexBuffer.modify(base, offset, offset, (changed - first) * quadSize);
+            }
+        }
+        else if (size <= m_BufferSize)
+        {
+            QUInt32 offset = first * quadSize;
+            m_VertexBuffer.modify(base, offset, offset, size - offset);
+        }
+        else
+        {
+            m_VertexBuffer.fill(base, size);
+            m_BufferSize = size;
+        }
+
+        return true;
     }
 
 
@@ -388,15 +854,13 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void Text::render()
     {
-        // Constructs the MVP matrix
-        glm::mat4 identity      = glm::mat4(1.f);
-        glm::mat4 projection    = glm::ortho(0.f, m_WinW, m_WinH, 0.f);
-        glm::mat4 translation   = glm::translate(identity, glm::vec3(x(), y(), 0.f));
-        glm::mat4 origin        = glm::translate(identity, glm::vec3(-originX(), -originY(), 0.f));
-        glm::mat4 rotation      = glm::rotate(identity, glm::radians(angle()), glm::vec3(0.f, 0.f, 1.f));
-        glm::mat4 iorigin       = glm::translate(identity, glm::vec3(originX(), originY(), 0.f));
-        glm::mat4 scaling       = glm::scale(identity, glm::vec3(scale(), scale(), 1.f));
-        glm::mat4 mvp           = projection * translation * iorigin * rotation * origin * scaling * identity;
+        refresh();
+        if (!Culling::isVisible(bounds()))
+            return;
+
+        // Constructs the MVP matrix from the cached transform
+        float mvp[16];
+        (m_Projection * transform().translated(x(), y())).toMatrix(mvp);
 
 
         // Binds all necessary objects
@@ -406,12 +870,12 @@ namespace Qube2D
 
 
         // Binds the font texture
-        glCheck(glActiveTexture(GL_TEXTURE0));
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_Font->texture().id()));
+        GLState::activeTexture(0);
+        GLState::bindTexture(texture().id());
         glCheck(glUniform1i(m_UniformSampler, 0));
 
         // Forwards the MVP matrix to the shader
-        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, &mvp[0][0]));
+        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, mvp));
 
 
         // Enables all the used vertex attributes
@@ -437,8 +901,12 @@ namespace Qube2D
 
 
         // Renders the drop shadow first
+        float edge[3];
         if (m_Style & TextStyle::DropShadow)
         {
+            passEdges(TextStyle::DropShadow, edge);
+            glCheck(glUniform3fv(m_UniformEdge, 1, edge));
+
             float alpha = std::max(0.1f, m_Color.a()-0.5f);
             glCheck(glUniform4f(m_UniformColor,
                                 m_Color.r(),
@@ -447,10 +915,7 @@ namespace Qube2D
                                 m_Color.a()));
 
             glCheck(glUniform1f(m_UniformOpacity, alpha));
-            glCheck(glDrawArrays(
-                        GL_TRIANGLES,
-                        m_VertexCount+m_OutlineVertexCount,
-                        m_ShadowVertexCount));
+            drawQuads(m_QuadCount + m_OutlineQuadCount, m_ShadowQuadCount);
         }
 
         // Forwards the opacity to the shader
@@ -459,16 +924,15 @@ namespace Qube2D
         // Renders the outlines
         if (m_Style & TextStyle::Outline)
         {
+            passEdges(TextStyle::Outline, edge);
+            glCheck(glUniform3fv(m_UniformEdge, 1, edge));
             glCheck(glUniform4f(m_UniformColor,
                                 m_OutlineColor.r(),
                                 m_OutlineColor.g(),
                                 m_OutlineColor.b(),
                                 m_OutlineColor.a()));
 
-            glCheck(glDrawArrays(
-                        GL_TRIANGLES,
-                        m_VertexCount,
-                        m_OutlineVertexCount));
+            drawQuads(m_QuadCount, m_OutlineQuadCount);
         }
 
 
@@ -480,20 +944,109 @@ namespace Qube2D
                             m_Color.a()));
 
         // Renders the regular glyphs
-        glCheck(glDrawArrays(
-                    GL_TRIANGLES,
-                    GL_ZERO,
-                    m_VertexCount));
+        passEdges(TextStyle::Regular, edge);
+        glCheck(glUniform3fv(m_UniformEdge, 1, edge));
+        drawQuads(0, m_QuadCount);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      drawQuads
+    ///
+    ///////////////////////////////////////////////////////////
+    void Text::drawQuads(QUInt32 first, QUInt32 count)
+    {
+        // 16-bit indices address at most TEXT_MAX_QUADS quads at once
+        while (count > 0)
+        {
+            QUInt32 batch = std::min<QUInt32>(count, TEXT_MAX_QUADS);
+            glCheck(glDrawElementsBaseVertex(
+                        GL_TRIANGLES,
+                        batch * TEXT_QUAD_INDICES,
+                        GL_UNSIGNED_SHORT,
+                        NULL,
+                        first * 4));
 
+            first += batch;
+            count -= batch;
+        }
+    }
 
-        // Disables all the used vertex attributes
-        m_VertexArray.disableAttrib(1);
-        m_VertexArray.disableAttrib(0);
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      passEdges -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    void Text::passEdges(TextStyle pass, QFloat *edge) const
+    {
+        edge[0] = edge[1] = edge[2] = 0.f;
+        if (!m_DistanceField)
+            return;
+
+        // Converts on-screen pixels to distance field units
+        QFloat unit = 1.f / (FONT_SDF_SPREAD * 2.f * m_GlyphScale);
+        QFloat outer = TEXT_SDF_EDGE, inner = 0.f;
+
+        if (pass & TextStyle::Outline)
+            outer -= m_OutlineWidth * unit;
+        else if (m_Style & TextStyle::Bold)
+            outer -= (m_Size / 36.f) * 0.5f * unit;
+        else if (m_Style & TextStyle::OutlineOnly)
+        {
+            // Strokes both sides of the contour, like the stroker
+            outer -= m_OutlineWidth * unit;
+            inner = TEXT_SDF_EDGE + m_OutlineWidth * unit;
+        }
 
-        // Unbinds the necessary objects
-        m_VertexArray.unbind();
-        m_VertexBuffer.unbind();
-        m_ShaderProgram.unbind();
+        edge[0] = std::max(outer, TEXT_SDF_MIN_EDGE);
+        edge[1] = inner;
+        edge[2] = (pass & TextStyle::DropShadow) ? TEXT_SDF_SOFTNESS : 0.f;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      font -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    Font *Text::font() const
+    {
+        return m_Font;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      texture -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    const Texture &Text::texture() const
+    {
+        return m_Font->texture(m_Page);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      bounds -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    RectF Text::bounds() const
+    {
+        return transform().translated(x(), y()).mapRect(m_LocalBounds);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      boundsChanged
+    ///
+    ///////////////////////////////////////////////////////////
+    void Text::boundsChanged()
+    {
+        invalidateBounds();
     }
 
 
@@ -521,6 +1074,25 @@ namespace Qube2D
         m_UniformSampler = m_ShaderProgram.getUniformLocation("uni_texture");
         m_UniformOpacity = m_ShaderProgram.getUniformLocation("uni_opacity");
         m_UniformColor = m_ShaderProgram.getUniformLocation("uni_color");
+        m_UniformEdge = m_ShaderProgram.getUniformLocation("uni_edge");
+
+        // Every text shares one 16-bit index buffer: quads beyond
+        // TEXT_MAX_QUADS are drawn in batches with a base vertex.
+        std::vector<QUInt16> indices(TEXT_MAX_QUADS * TEXT_QUAD_INDICES);
+        for (QUInt32 i = 0; i < TEXT_MAX_QUADS; ++i)
+        {
+            QUInt16 *quad = &indices[i * TEXT_QUAD_INDICES];
+            QUInt16 first = static_cast<QUInt16>(i * 4);
+            quad[0] = first + 0; quad[1] = first + 1; quad[2] = first + 2;
+            quad[3] = first + 2; quad[4] = first + 1; quad[5] = first + 3;
+        }
+
+        // The vertex array keeps the element buffer binding
+        m_VertexArray.bind();
+        m_IndexBuffer.create(BufferType::Index, BufferUsage::Static);
+        m_IndexBuffer.bind();
+        m_IndexBuffer.fill(indices.data(), indices.size() * sizeof(QUInt16));
+        m_VertexArray.unbind();
     }
 
     ///////////////////////////////////////////////////////////
@@ -531,6 +1103,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void Text::destroyGL()
     {
+        m_IndexBuffer.destroy();
         m_VertexShader.destroy();
         m_FragShader.destroy();
         m_ShaderProgram.destroy();
@@ -538,22 +1111,34 @@ namespace Qube2D
     }
 
 
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Qube2D_Text_Add_Quad
+    ///
+    ///////////////////////////////////////////////////////////
+    float *Qube2D_Text_Add_Quad(float *v, QFloat x, QFloat y, QFloat w, QFloat h,
+                                QFloat u, QFloat t0, QFloat s, QFloat t)
+    {
+        v[0]  = x; v[1]  = y; v[2]  = u; v[3]  = t0;
+        v[4]  = w; v[5]  = y; v[6]  = s; v[7]  = t0;
+        v[8]  = x; v[9]  = h; v[10] = u; v[11] = t;
+        v[12] = w; v[13] = h; v[14] = s; v[15] = t;
+
+        return v + TEXT_QUAD_FLOATS;
+    }
+
     ///////////////////////////////////////////////////////////
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
     /// \date    September 17th, 2016
     /// \fn      Qube2D_Text_Add_Line
     ///
     ///////////////////////////////////////////////////////////
-    void Qube2D_Text_Add_Line(std::vector<float> &v, const RectF &bounds)
+    float *Qube2D_Text_Add_Line(float *v, const RectF &bounds)
     {
         QFloat x = bounds.x(),          w = x + bounds.width();
         QFloat y = roundf(bounds.y()),  h = y + bounds.height();
 
-        v.push_back(x); v.push_back(y); v.push_back(1); v.push_back(1);
-        v.push_back(w); v.push_back(y); v.push_back(1); v.push_back(1);
-        v.push_back(x); v.push_back(h); v.push_back(1); v.push_back(1);
-        v.push_back(x); v.push_back(h); v.push_back(1); v.push_back(1);
-        v.push_back(w); v.push_back(y); v.push_back(1); v.push_back(1);
-        v.push_back(w); v.push_back(h); v.push_back(1); v.push_back(1);
+        return Qube2D_Text_Add_Quad(v, x, y, w, h, 1, 1, 1, 1);
     }
 }
@@ -36,6 +36,8 @@
 ///////////////////////////////////////////////////////////
 #include <Qube2D/Graphics/Text/TextErrors.hpp>
 #include <Qube2D/Graphics/Text/Font.hpp>
+#include <Qube2D/Assets/Assets.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
 #include <Qube2D/Debug/GLCheck.hpp>
 #include <Qube2D/Debug/Debug.hpp>
 #include <glad/glad.h>
@@ -45,32 +47,70 @@
 #include FT_BITMAP_H
 #include FT_IMAGE_H
 #include FT_SIZES_H
+#include FT_ADVANCES_H
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <fstream>
+#include <vector>
 
 
 namespace Qube2D
 {
     ///////////////////////////////////////////////////////////
-    // Static variable definition
+    // Constant definitions
     //
     ///////////////////////////////////////////////////////////
-    FT_Stroker Font::m_Stroker = NULL;
-    FT_Library Font::m_LibRef = NULL;
+    #define FONT_CACHE_MAGIC        0x46443251u     // "Q2DF"
+    #define FONT_CACHE_VERSION      1u
 
 
     ///////////////////////////////////////////////////////////
-    /// \fn       Qube2D_Font_Set_Stroker -> inline
-    /// \brief    Specifies the size of the stroker.
+    /// \file    Font.cpp
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \brief   Layout of a glyph cache file.
+    ///
+    /// The header is followed by 'pageCount' pages, each one a
+    /// FontCachePage and the first 'rows' rows of its texture,
+    /// and then by 'glyphCount' FontCacheGlyph entries. All
+    /// values are stored in native byte order; the version must
+    /// be increased whenever one of the structures changes.
     ///
     ///////////////////////////////////////////////////////////
-    inline void Qube2D_Font_Set_Stroker(QUInt32 size)
+    struct FontCacheHeader
     {
-        FT_Stroker_Set(Font::m_Stroker,
-                       static_cast<QInt64>(size * 64),
-                       FT_STROKER_LINECAP_ROUND,
-                       FT_STROKER_LINEJOIN_ROUND,
-                       true);
-    }
+        QUInt32 magic;          ///< FONT_CACHE_MAGIC
+        QUInt32 version;        ///< FONT_CACHE_VERSION
+        QUInt64 hash;           ///< Hash of the font file
+        QUInt32 sdfSize;        ///< FONT_SDF_SIZE at the time
+        QUInt32 sdfSpread;      ///< FONT_SDF_SPREAD at the time
+        QUInt32 pageCount;      ///< Amount of stored pages
+        QUInt32 glyphCount;     ///< Amount of stored glyphs
+    };
+
+    struct FontCachePage
+    {
+        QUInt32 page;           ///< Index of the page
+        QUInt32 rows;           ///< Rows of pixels that follow
+    };
+
+    struct FontCacheGlyph
+    {
+        QUInt32 size;           ///< Size key of the glyph table
+        QUInt32 slot;           ///< One of the GLYPH_SLOT_* constants
+        QUInt32 cp;             ///< Codepoint of the character
+        Glyph glyph;            ///< Metrics and texture region
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    // Static variable definition
+    //
+    ///////////////////////////////////////////////////////////
+    FT_Stroker Font::m_Stroker = NULL;
+    FT_Library Font::m_LibRef = NULL;
+
 
     ///////////////////////////////////////////////////////////
     /// \fn       Qube2D_Font_Atlas_By_Size -> inline
@@ -94,21 +134,85 @@ namespace Qube2D
     }
 
 
+    ///////////////////////////////////////////////////////////
+    /// \fn       Qube2D_Font_Create_Page -> inline
+    /// \brief    Creates the texture of one font page.
+    ///
+    ///////////////////////////////////////////////////////////
+    inline void Qube2D_Font_Create_Page(Texture &texture)
+    {
+        texture.create(2048, 2048, TextureFormat::FormatRED);
+        texture.setHorizontalWrap(WrapMode::ClampToEdge);
+        texture.setVerticalWrap(WrapMode::ClampToEdge);
+        texture.setMinFilter(InterpolationMode::LinearInterpolation);
+        texture.setMagFilter(InterpolationMode::LinearInterpolation);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       Qube2D_Font_Packed_Space -> inline
+    /// \brief    Restores the padded rectangle of a glyph.
+    /// \returns  the rectangle the packer returned for it.
+    ///
+    ///////////////////////////////////////////////////////////
+    inline RectI Qube2D_Font_Packed_Space(const Glyph &glyph)
+    {
+        return RectI(static_cast<QInt32>(std::lround(glyph.texture_x * 2048.f)) - 1,
+                     static_cast<QInt32>(std::lround(glyph.texture_y * 2048.f)) - 1,
+                     glyph.glyph_w + 2,
+                     glyph.glyph_h + 2);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       Qube2D_Font_Hash_File -> inline
+    /// \brief    Computes the 64-bit FNV-1a hash of a file.
+    /// \returns  FALSE if the file could not be read.
+    ///
+    ///////////////////////////////////////////////////////////
+    inline QBool Qube2D_Font_Hash_File(const std::string &path, QUInt64 &hash)
+    {
+        std::ifstream file(path, std::ios_base::binary);
+        if (!file.is_open())
+            return false;
+
+        char buffer[4096];
+        hash = 0xCBF29CE484222325ull;
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+        {
+            for (std::streamsize i = 0; i < file.gcount(); i++)
+            {
+                hash ^= static_cast<QUInt8>(buffer[i]);
+                hash *= 0x100000001B3ull;
+            }
+        }
+
+        return true;
+    }
+
+
     ///////////////////////////////////////////////////////////
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
     /// \date    September 15th, 2016
     /// \fn      Constructor
     ///
     ///////////////////////////////////////////////////////////
-    Font::Font(FT_FaceRec_ *face)
+    Font::Font(FT_FaceRec_ *face, const char *path)
         : Uncopyable(),
           m_Face(face),
-          m_Size(0u)
+          m_Size(0u),
+          m_Requested(0u),
+          m_Page(0u),
+          m_Clock(0u),
+          m_OutlineWidth(0.f),
+          m_DistanceField(false),
+          m_Path(path),
+          m_MetricsLibrary(NULL),
+          m_MetricsFace(NULL)
     {
         // Select encoding
         FT_Select_Charmap(face, FT_ENCODING_UNICODE);
-        m_Textures = new Texture[5];
-        m_Packer = new Atlas<2048>[5];
+        m_Textures = new Texture[FONT_PAGE_COUNT];
+        m_Packer = new Atlas<2048>[FONT_PAGE_COUNT];
+        std::fill(m_Generations, m_Generations + FONT_PAGE_COUNT, 0u);
     }
 
     ///////////////////////////////////////////////////////////
@@ -119,9 +223,18 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     Font::~Font()
     {
+        m_Rasterizer.stop();
         FT_Done_Face(m_Face);
 
-        for (QUInt32 i = 0; i < 5; ++i)
+        if (m_MetricsFace != NULL)
+            FT_Done_Face(m_MetricsFace);
+        if (m_MetricsLibrary != NULL)
+            FT_Done_FreeType(m_MetricsLibrary);
+
+        if (m_UploadBuffer.id() != 0)
+            m_UploadBuffer.destroy();
+
+        for (QUInt32 i = 0; i < FONT_PAGE_COUNT; ++i)
             m_Textures[i].destroy();
 
         delete[] m_Textures;
@@ -137,6 +250,14 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     void Font::extract(QUInt32 size)
     {
+        // Glyphs fetched from now on belong to a new layout
+        ++m_Clock;
+
+        // Distance fields are rasterized at the reference size only
+        m_Requested = size;
+        if (m_DistanceField)
+            size = FONT_SDF_SIZE;
+
         // Attempts to set the pixel size
         if (FT_Set_Pixel_Sizes(m_Face, 0, size))
         {
@@ -154,28 +275,17 @@ namespace Qube2D
                 m_Bearings.insert(std::make_pair(size, m_Face->glyph->bitmap_top));
 
         m_Size = size;
-        m_Page = Qube2D_Font_Atlas_By_Size(size);
-
-
-        // Determines whether the page for this size was already created
-        if (m_Atlas.find(size) != m_Atlas.end())
-            return;
-
-        // Adds a new, empty page
-        m_Atlas.insert(std::make_pair(size, GlyphAtlas()));
+        m_Page = m_DistanceField ? FONT_SDF_PAGE : Qube2D_Font_Atlas_By_Size(size);
 
 
         // Determines whether a texture for this size range already exists
-        // and creates one if that is not the case
+        // and creates one if that is not the case; glyphs restored from a
+        // cache may exist before their page does
         if (m_Textures[m_Page].id() == 0)
-        {
-            Texture &texture = m_Textures[m_Page];
-            texture.create(2048, 2048, TextureFormat::FormatRED);
-            texture.setHorizontalWrap(WrapMode::ClampToEdge);
-            texture.setVerticalWrap(WrapMode::ClampToEdge);
-            texture.setMinFilter(InterpolationMode::LinearInterpolation);
-            texture.setMagFilter(InterpolationMode::LinearInterpolation);
-        }
+            Qube2D_Font_Create_Page(m_Textures[m_Page]);
+
+        // Selects the glyphs of this size
+        m_Glyphs.setSize(m_DistanceField ? FONT_SDF_KEY : size);
     }
 
     ///////////////////////////////////////////////////////////
@@ -208,16 +318,7 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     bool Font::isCached(QUInt32 cp, TextStyle style) const
     {
-        // Determines whether 'cp' is already cached
-        const GlyphAtlas &atlas = m_Atlas.at(m_Size);
-        if (style & TextStyle::Bold)
-            return (atlas.glyphsBold.find(cp) != atlas.glyphsBold.end());
-        else if (style & TextStyle::Outline)
-            return (atlas.glyphsOutline.find(cp) != atlas.glyphsOutline.end());
-        else if (style & TextStyle::OutlineOnly)
-            return (atlas.glyphsBorder.find(cp) != atlas.glyphsBorder.end());
-        else
-            return (atlas.glyphs.find(cp) != atlas.glyphs.end());
+        return m_Glyphs.find(cp, slotOf(style)) != NULL;
     }
 
     ///////////////////////////////////////////////////////////
@@ -239,15 +340,50 @@ namespace Qube2D
     ///////////////////////////////////////////////////////////
     const Glyph &Font::glyph(QUInt32 cp, TextStyle style) const
     {
-        const GlyphAtlas &atlas = m_Atlas.at(m_Size);
-        if (style & TextStyle::Bold)
-            return atlas.glyphsBold.at(cp);
-        else if (style & TextStyle::Outline)
-            return atlas.glyphsOutline.at(cp);
-        else if (style & TextStyle::OutlineOnly)
-            return atlas.glyphsBorder.at(cp);
-        else
-            return atlas.glyphs.at(cp);
+        return *m_Glyphs.find(cp, slotOf(style));
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      fetch
+    ///
+    ///////////////////////////////////////////////////////////
+    const Glyph &Font::fetch(QUInt32 cp, TextStyle style)
+    {
+        static const Glyph empty;
+
+        // One lookup for cached glyphs, which is the common case
+        QUInt32 slot = slotOf(style);
+        Glyph *glyph = m_Glyphs.find(cp, slot);
+        if (glyph)
+        {
+            glyph->last_used = m_Clock;
+            return *glyph;
+        }
+
+        if (!m_Rasterizer.isRunning())
+        {
+            cacheGlyph(cp, style);
+            glyph = m_Glyphs.find(cp, slot);
+            return glyph ? *glyph : empty;
+        }
+
+
+        // Queues the glyph once; only its advance is needed meanwhile
+        GlyphJob job = makeJob(cp, style);
+        if (m_Pending.insert(FONT_JOB_KEY(job.key, slot, cp)).second)
+            m_Rasterizer.request(job);
+
+        FT_Fixed advance;
+        m_Placeholder = Glyph();
+        if (!FT_Get_Advance(m_Face, charIndex(cp), FT_LOAD_DEFAULT, &advance))
+            m_Placeholder.advance = advance / 65536.f;
+
+        if (!m_DistanceField && (style & TextStyle::Bold || style & TextStyle::Outline || style & TextStyle::OutlineOnly))
+            m_Placeholder.advance += m_OutlineWidth;
+
+        return m_Placeholder;
     }
 
     ///////////////////////////////////////////////////////////
@@ -261,135 +397,254 @@ namespace Qube2D
         return m_Textures[m_Page];
     }
 
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      texture -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    const Texture &Font::texture(QUInt32 page) const
+    {
+        return m_Textures[page];
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      page -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 Font::page() const
+    {
+        return m_Page;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      generation -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 Font::generation(QUInt32 page) const
+    {
+        return m_Generations[page];
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      clock -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 Font::clock() const
+    {
+        return m_Clock;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      touch
+    ///
+    ///////////////////////////////////////////////////////////
+    void Font::touch(const String &text, QUInt32 size, TextStyle style, QBool distanceField)
+    {
+        QUInt32 key = distanceField ? FONT_SDF_KEY : size;
+        QUInt32 current = m_DistanceField ? FONT_SDF_KEY : m_Size;
+        QUInt32 outline = slotOf(style);
+        QUInt32 regular = slotOf(style & ~TextStyle::Outline);
+
+        // Looks up the glyphs the same way the layout fetched them
+        if (key != current)
+            m_Glyphs.setSize(key);
+
+        for (QUInt32 i = 0; i < text.length(); ++i)
+        {
+            char32_t c = text.at(i);
+            if (c == '\n' || c == ' ' || c == '\t')
+                continue;
+
+            Glyph *glyph = m_Glyphs.find(c, regular);
+            if (glyph)
+                glyph->last_used = m_Clock;
+
+            if (style & TextStyle::Outline)
+            {
+                glyph = m_Glyphs.find(c, outline);
+                if (glyph)
+                    glyph->last_used = m_Clock;
+            }
+        }
+
+        if (key != current)
+            m_Glyphs.setSize(current);
+    }
+
     ///////////////////////////////////////////////////////////
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
     /// \date    September 16th, 2016
-    /// \fn      kerning -> const
+    /// \fn      kerning
     ///
     ///////////////////////////////////////////////////////////
-    QFloat Font::kerning(QUInt32 prev, QUInt32 cur) const
+    QFloat Font::kerning(QUInt32 prev, QUInt32 cur)
     {
+        // The first glyph of a line is never kerned
+        if (prev == 0 || !FT_HAS_KERNING(m_Face))
+            return 0.f;
+
+        QUInt64 key = FONT_KERNING_KEY(m_Size, prev, cur);
+        std::unordered_map<QUInt64, QFloat>::iterator it = m_Kerning.find(key);
+        if (it != m_Kerning.end())
+            return it->second;
+
+        // Precomputed ranges only hold the pairs that are kerned
+        std::set<QUInt64>::iterator range = m_KernedRanges.lower_bound(FONT_KERNING_KEY(m_Size, 0, 0));
+        std::set<QUInt64>::iterator last = m_KernedRanges.lower_bound(FONT_KERNING_KEY(m_Size + 1, 0, 0));
+        for (; range != last; ++range)
+        {
+            QUInt32 min = (*range >> 21) & FONT_KERNING_CP_MASK;
+            QUInt32 max = *range & FONT_KERNING_CP_MASK;
+            if (prev >= min && prev < max && cur >= min && cur < max)
+                return 0.f;
+        }
+
+        // FreeType expects glyph indices rather than characters
         FT_Vector v;
-        FT_Get_Kerning(m_Face, prev, cur, FT_KERNING_DEFAULT, &v);
-        return static_cast<QFloat>(v.x >> 6);
+        QFloat value = 0.f;
+        if (!FT_Get_Kerning(m_Face, charIndex(prev), charIndex(cur), FT_KERNING_DEFAULT, &v))
+            value = static_cast<QFloat>(v.x >> 6);
 
+        m_Kerning.insert(std::make_pair(key, value));
+        return value;
     }
 
     ///////////////////////////////////////////////////////////
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
-    /// \date    September 15th, 2016
-    /// \fn      cacheGlyph
+    /// \date    October 17th, 2026
+    /// \fn      scale -> const
     ///
     ///////////////////////////////////////////////////////////
-    void Font::cacheGlyph(QUInt32 cp, TextStyle style)
+    QFloat Font::scale() const
     {
-        QInt32 loadFlags;
-        if (style & TextStyle::Bold || style & TextStyle::OutlineOnly || style & TextStyle::Outline)
-            loadFlags = FT_LOAD_TARGET_NORMAL|FT_LOAD_FORCE_AUTOHINT|FT_LOAD_NO_BITMAP;
-        else
-            loadFlags = FT_LOAD_RENDER;
+        if (!m_DistanceField || m_Size == 0)
+            return 1.f;
 
+        return static_cast<QFloat>(m_Requested) / m_Size;
+    }
 
-        // Attempts to load and render a character
-        if (FT_Load_Char(m_Face, cp, loadFlags))
-        {
-        #ifdef Q2D_DEBUG
-            std::string n = std::to_string(cp);
-        #endif
-            Q2DError(Q2D_FONT_ERROR_1, m_Face->family_name, n.c_str());
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      layouts
+    ///
+    ///////////////////////////////////////////////////////////
+    LayoutCache &Font::layouts()
+    {
+        return m_Layouts;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      upload
+    ///
+    ///////////////////////////////////////////////////////////
+    void Font::upload()
+    {
+        std::vector<GlyphBitmap> done;
+        m_Rasterizer.collect(done);
+        if (done.empty())
             return;
-        }
 
 
-        if (style & TextStyle::Bold)
+        // Packs every glyph first and gathers their pixels in one block
+        std::vector<QUInt8> staging;
+        std::vector<RectI> spaces;
+        std::vector<QUInt32> pages;
+        std::vector<std::size_t> offsets;
+        QBool changed[FONT_PAGE_COUNT] = { false };
+
+        for (std::size_t i = 0; i < done.size(); i++)
         {
-            QInt64 strength = static_cast<QInt64>((m_Size / 36.f) * 64);
-            FT_Glyph glyph;
-            FT_BitmapGlyph bmp;
-
-            // Converts the glyph to a bitmap
-            FT_Get_Glyph(m_Face->glyph, &glyph);
-            FT_Glyph_To_Bitmap(&glyph, FT_RENDER_MODE_NORMAL, NULL, 1);
-            bmp = (FT_BitmapGlyph) glyph;
-
-            // Emboldens the bitmap
-            FT_Bitmap_Embolden(m_LibRef, &bmp->bitmap, strength, strength);
-            m_Face->glyph->bitmap = bmp->bitmap;
+            const GlyphBitmap &bitmap = done[i];
+            m_Pending.erase(FONT_JOB_KEY(bitmap.job.key, bitmap.job.slot, bitmap.job.cp));
+
+            if (bitmap.failed)
+            {
+            #ifdef Q2D_DEBUG
+                std::string n = std::to_string(bitmap.job.cp);
+            #endif
+                Q2DError(Q2D_FONT_ERROR_1, m_Face->family_name, n.c_str());
+                continue;
+            }
+
+            RectI space;
+            if (!store(bitmap, space) || !space.isValid())
+                continue;
+
+            spaces.push_back(space);
+            pages.push_back(bitmap.job.page);
+            offsets.push_back(staging.size());
+            staging.insert(staging.end(), bitmap.pixels.begin(), bitmap.pixels.end());
+            changed[bitmap.job.page] = true;
         }
-        else if (style & TextStyle::OutlineOnly || style & TextStyle::Outline)
+
+        if (staging.empty())
+            return;
+
+
+        // Transfers all pixels at once; the copies into the pages
+        // then read from the pixel unpack buffer
+        if (m_UploadBuffer.id() == 0)
+            m_UploadBuffer.create(BufferType::PixelUnpack, BufferUsage::Stream);
+
+        m_UploadBuffer.bind();
+        m_UploadBuffer.fill(staging.data(), static_cast<int>(staging.size()));
+
+        for (std::size_t i = 0; i < spaces.size(); i++)
         {
-            FT_Glyph glyph;
-            FT_Get_Glyph(m_Face->glyph, &glyph);
-            Qube2D_Font_Set_Stroker(m_OutlineWidth);
-
-            // Applies the outline
-            if (style & TextStyle::OutlineOnly)
-                FT_Glyph_Stroke(&glyph, m_Stroker, 1);
-            else
-                FT_Glyph_StrokeBorder(&glyph, m_Stroker, 0, 1);
-
-            FT_Glyph_To_Bitmap(&glyph, FT_RENDER_MODE_NORMAL, NULL, 1);
-            m_Face->glyph->bitmap = ((FT_BitmapGlyph) glyph)->bitmap;
+            m_Textures[pages[i]].updatePixels(
+                        reinterpret_cast<const QUInt8 *>(offsets[i]),
+                        spaces[i],
+                        TextureFormat::FormatRED);
         }
 
+        m_UploadBuffer.unbind();
 
-        // Finds suitable space for this glyph
-        QUInt8 *pixels = m_Face->glyph->bitmap.buffer;
-        Texture &texture = m_Textures[m_Page];
-        RectI space = m_Packer[m_Page].find(
-                    m_Face->glyph->bitmap.width+2,
-                    m_Face->glyph->bitmap.rows+2);
 
-        space.rx()++;
-        space.ry()++;
-        space.rwidth()-=2;
-        space.rheight()-=2;
+        // Texts laid out with placeholders pick up the new glyphs
+        for (QUInt32 i = 0; i < FONT_PAGE_COUNT; ++i)
+        {
+            if (changed[i])
+                m_Generations[i]++;
+        }
+    }
 
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    September 15th, 2016
+    /// \fn      cacheGlyph
+    ///
+    ///////////////////////////////////////////////////////////
+    void Font::cacheGlyph(QUInt32 cp, TextStyle style)
+    {
+        GlyphBitmap bitmap;
+        bitmap.job = makeJob(cp, style);
 
-        if (!space.isValid() && pixels)
+        // Attempts to load and render a character
+        if (!GlyphRasterizer::rasterize(m_Face, m_Stroker, m_LibRef, bitmap))
         {
         #ifdef Q2D_DEBUG
             std::string n = std::to_string(cp);
         #endif
-            Q2DError(Q2D_FONT_ERROR_2, m_Face->family_name, n.c_str());
+            Q2DError(Q2D_FONT_ERROR_1, m_Face->family_name, n.c_str());
             return;
         }
 
-
         // Updates the pixel data, if not whitespace
-        if (pixels != NULL)
-            texture.updatePixels(
-                        pixels,
-                        space,
-                        TextureFormat::FormatRED);
-
-
-        // Initializes a new glyph structure and fills it
-        Glyph glyph;
-        glyph.texture_x = space.x() / 2048.f;
-        glyph.texture_y = space.y() / 2048.f;
-        glyph.texture_w = space.width() / 2048.f;
-        glyph.texture_h = space.height() / 2048.f;
-        glyph.glyph_w = space.width();
-        glyph.glyph_h = space.height();
-        glyph.bearing_x = (m_Face->glyph->metrics.horiBearingX / 64.f);
-        glyph.bearing_y = m_Bearings.at(m_Size) - (m_Face->glyph->metrics.horiBearingY / 64.f);
-        glyph.advance = m_Face->glyph->advance.x / 64.f;
-
-        if (style & TextStyle::Bold || style & TextStyle::Outline || style & TextStyle::OutlineOnly)
-            glyph.advance += m_OutlineWidth;
-
-
-        // Inserts a new entry (TODO: Stroker etc)
-        GlyphAtlas &atlas = m_Atlas.at(m_Size);
-        if (style & TextStyle::Bold)
-            atlas.glyphsBold.insert(std::make_pair(cp, glyph));
-        else if (style & TextStyle::Outline)
-            atlas.glyphsOutline.insert(std::make_pair(cp, glyph));
-        else if (style & TextStyle::OutlineOnly)
-            atlas.glyphsBorder.insert(std::make_pair(cp, glyph));
-        else
-            atlas.glyphs.insert(std::make_pair(cp, glyph));
+        RectI space;
+        if (store(bitmap, space) && space.isValid())
+            m_Textures[m_Page].updatePixels(bitmap.pixels.data(), space, TextureFormat::FormatRED);
     }
 
     ///////////////////////////////////////////////////////////
@@ -413,6 +668,114 @@ namespace Qube2D
         else if (set == Subset::Hiragana) { min = 0x3040; max = 0x309F; }
         else if (set == Subset::Katakana) { min = 0x30A0; max = 0x30FF; }
         for (QUInt32 i = min; i < max; ++i) { cacheGlyph(i, style); }
+        cacheKerning(min, max);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      charIndex
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 Font::charIndex(QUInt32 cp)
+    {
+        std::unordered_map<QUInt32, QUInt32>::iterator it = m_CharIndices.find(cp);
+        if (it != m_CharIndices.end())
+            return it->second;
+
+        QUInt32 index = FT_Get_Char_Index(m_Face, cp);
+        m_CharIndices.insert(std::make_pair(cp, index));
+        return index;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      cacheKerning
+    ///
+    ///////////////////////////////////////////////////////////
+    void Font::cacheKerning(QUInt32 min, QUInt32 max)
+    {
+        if (min >= max || !FT_HAS_KERNING(m_Face))
+            return;
+        if (!m_KernedRanges.insert(FONT_KERNING_KEY(m_Size, min, max)).second)
+            return;
+
+        // Resolves the glyph indices once for all pairs
+        std::vector<QUInt32> indices(max - min);
+        for (QUInt32 i = min; i < max; ++i)
+            indices[i - min] = charIndex(i);
+
+        // Stores the kerned pairs only; others are known to be zero
+        for (QUInt32 p = min; p < max; ++p)
+        {
+            if (indices[p - min] == 0)
+                continue;
+
+            for (QUInt32 c = min; c < max; ++c)
+            {
+                FT_Vector v;
+                if (indices[c - min] == 0 ||
+                    FT_Get_Kerning(m_Face, indices[p - min], indices[c - min], FT_KERNING_DEFAULT, &v) ||
+                    (v.x >> 6) == 0)
+                    continue;
+
+                m_Kerning[FONT_KERNING_KEY(m_Size, p, c)] = static_cast<QFloat>(v.x >> 6);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      setDistanceField
+    ///
+    ///////////////////////////////////////////////////////////
+    void Font::setDistanceField(QBool enabled)
+    {
+        m_DistanceField = enabled;
+
+        // Re-selects the glyphs of the last requested size
+        if (m_Requested != 0)
+            extract(m_Requested);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      isDistanceField -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Font::isDistanceField() const
+    {
+        return m_DistanceField;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      setThreadCount
+    ///
+    ///////////////////////////////////////////////////////////
+    void Font::setThreadCount(QUInt32 count)
+    {
+        // Queued glyphs are dropped and requested again on demand
+        m_Rasterizer.stop();
+        m_Pending.clear();
+
+        if (count != 0 && !m_Rasterizer.start(m_Path, count))
+            Q2DError(Q2D_FONT_ERROR_3, m_Face->family_name);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      setLayoutCacheSize
+    ///
+    ///////////////////////////////////////////////////////////
+    void Font::setLayoutCacheSize(QUInt32 count)
+    {
+        m_Layouts.setCapacity(count);
     }
 
     ///////////////////////////////////////////////////////////
@@ -425,15 +788,24 @@ namespace Qube2D
                              TextStyle style,
                              QUInt32 size)
     {
-        // First sets the size
-        extract(size);
+        std::lock_guard<std::mutex> lock(m_MetricsMutex);
+
+        // Repeated strings are measured only once; the mode may be
+        // switched by the render thread while measuring
+        QBool distanceField = m_DistanceField;
+        TextLayoutKey key = { &string, size, style, m_OutlineWidth, 0.f, 0.f, 0.f, distanceField, true };
+        TextLayout *layout = m_Measures.find(key);
+        if (layout != NULL)
+            return layout->size;
+        if (!openMetrics())
+            return { 0.f, 0.f };
 
 
         // Then calculate glyph-by-glpyh
         QUInt32 length = string.length();
-        QFloat line = lineSpacing();
+        QFloat line = (m_MetricsFace->height/64.f)*(72.f/96.f);
         QFloat width = 0, height = size*(72.f/96.f), max = 0;
-
+        char32_t prev = 0;
 
         for (QUInt32 i = 0; i < length; ++i)
         {
@@ -448,20 +820,97 @@ namespace Qube2D
                 continue;
             }
 
-            // Caches the glyph, if not already
-            if (!isCached(c, style))
-                cacheGlyph(c, style);
-
-            // Adds to the width
-            width += glyph(c, style).advance;
+            // Adds to the width; only whitespace leaves 'prev' alone
+            width += advanceOf(prev, c, style, size, distanceField);
+            if (c != ' ' && c != '\t')
+                prev = c;
         }
 
         if (width > max)
             max = width;
 
+        if ((layout = m_Measures.insert(key)) != NULL)
+        {
+            layout->size.setWidth(max);
+            layout->size.setHeight(height);
+        }
+
         return { max, height };
     }
 
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      wrapString
+    ///
+    ///////////////////////////////////////////////////////////
+    String Font::wrapString(const String &string,
+                            TextStyle style,
+                            QUInt32 size,
+                            QFloat width)
+    {
+        std::lock_guard<std::mutex> lock(m_MetricsMutex);
+        if (!openMetrics())
+            return string;
+
+        QBool distanceField = m_DistanceField;
+
+
+        QUInt32 length = string.length();
+        std::u32string lines;
+        lines.reserve(length + length / 8);
+
+        // 'rest' is the width of the line behind its last space
+        QFloat x = 0.f, rest = 0.f;
+        std::size_t space = std::u32string::npos;
+        char32_t prev = 0;
+
+        for (QUInt32 i = 0; i < length; ++i)
+        {
+            char32_t c = string.at(i);
+            if (c == '\n')
+            {
+                lines.push_back(c);
+                space = std::u32string::npos;
+                x = 0.f;
+                continue;
+            }
+
+            QFloat advance = advanceOf(prev, c, style, size, distanceField);
+            if (c == ' ')
+            {
+                space = lines.size();
+                lines.push_back(c);
+                x += advance;
+                rest = 0.f;
+                continue;
+            }
+
+            // Moves the current word to the next line if it ends behind the
+            // border; breaks it between two characters if it is too wide
+            if (x + advance > width && x > 0.f && space != std::u32string::npos)
+            {
+                lines[space] = '\n';
+                space = std::u32string::npos;
+                x = rest;
+            }
+            if (x + advance > width && x > 0.f)
+            {
+                lines.push_back('\n');
+                x = 0.f;
+            }
+
+            lines.push_back(c);
+            x += advance;
+            rest += advance;
+            if (c != '\t')
+                prev = c;
+        }
+
+        lines.push_back(0);
+        return String(lines.data());
+    }
+
     ///////////////////////////////////////////////////////////
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
     /// \date    September 15th, 2016
@@ -472,7 +921,7 @@ namespace Qube2D
     {
         // Retrieves the OpenGL texture's pixels
         char *buffer = new char[2048*2048];
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_Textures[m_Page].id()));
+        GLState::bindTexture(m_Textures[m_Page].id());
         glCheck(glGetTexImage(GL_TEXTURE_2D, GL_ZERO, GL_RED, GL_UNSIGNED_BYTE, buffer));
 
         // Writes buffer to the file
@@ -485,4 +934,444 @@ namespace Qube2D
         // Frees buffer
         delete[] buffer;
     }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      saveCache
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Font::saveCache(const char *path)
+    {
+        assert(path);
+
+        FontCacheHeader header;
+        header.magic = FONT_CACHE_MAGIC;
+        header.version = FONT_CACHE_VERSION;
+        header.sdfSize = FONT_SDF_SIZE;
+        header.sdfSpread = FONT_SDF_SPREAD;
+        if (!Qube2D_Font_Hash_File(m_Path, header.hash))
+            return false;
+
+
+        // Only stores the rows of each page that contain glyphs
+        std::vector<GlyphRef> refs;
+        QUInt32 rows[FONT_PAGE_COUNT] = { 0 };
+        m_Glyphs.collect(refs);
+
+        for (std::size_t i = 0; i < refs.size(); i++)
+        {
+            const Glyph &glyph = *refs[i].glyph;
+            if (glyph.glyph_w <= 0)
+                continue;
+
+            RectI space = Qube2D_Font_Packed_Space(glyph);
+            QUInt32 bottom = static_cast<QUInt32>(space.y() + space.height());
+            rows[glyph.atlas_page] = std::max(rows[glyph.atlas_page], std::min(bottom, 2048u));
+        }
+
+        header.pageCount = 0;
+        header.glyphCount = static_cast<QUInt32>(refs.size());
+        for (QUInt32 i = 0; i < FONT_PAGE_COUNT; ++i)
+        {
+            if (rows[i] != 0 && m_Textures[i].id() != 0)
+                header.pageCount++;
+        }
+
+
+        // Determines whether the given path is relative or absolute
+        std::string file = path;
+        if (Assets::isRelative(path))
+            file = Assets::makePath(path);
+
+        std::fstream stream;
+        stream.open(file, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        if (!stream.is_open())
+            return false;
+
+        stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+
+        // Retrieves the OpenGL textures' pixels
+        std::vector<char> pixels(2048 * 2048);
+        for (QUInt32 i = 0; i < FONT_PAGE_COUNT; ++i)
+        {
+            if (rows[i] == 0 || m_Textures[i].id() == 0)
+                continue;
+
+            FontCachePage page = { i, rows[i] };
+            GLState::bindTexture(m_Textures[i].id());
+            glCheck(glGetTexImage(GL_TEXTURE_2D, GL_ZERO, GL_RED, GL_UNSIGNED_BYTE, pixels.data()));
+
+            stream.write(reinterpret_cast<const char *>(&page), sizeof(page));
+            stream.write(pixels.data(), page.rows * 2048);
+        }
+
+        for (std::size_t i = 0; i < refs.size(); i++)
+        {
+            FontCacheGlyph entry = { refs[i].size, refs[i].slot, refs[i].cp, *refs[i].glyph };
+            stream.write(reinterpret_cast<const char *>(&entry), sizeof(entry));
+        }
+
+        stream.flush();
+        return stream.good();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      loadCache
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Font::loadCache(const char *path)
+    {
+        assert(path);
+
+        std::string file = path;
+        if (Assets::isRelative(path))
+            file = Assets::makePath(path);
+
+
+        // Reads the whole file at once
+        std::fstream stream;
+        stream.open(file, std::ios_base::in | std::ios_base::binary);
+        if (!stream.is_open())
+            return false;
+
+        stream.seekg(0, std::ios_base::end);
+        std::size_t size = static_cast<std::size_t>(stream.tellg());
+        std::vector<QUInt8> bytes(size);
+        stream.seekg(0, std::ios_base::beg);
+        if (size < sizeof(FontCacheHeader) || !stream.read(reinterpret_cast<char *>(bytes.data()), size))
+            return false;
+
+
+        // Rejects caches of other font files or glyph layouts
+        FontCacheHeader header;
+        QUInt64 hash;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        if (header.magic != FONT_CACHE_MAGIC || header.version != FONT_CACHE_VERSION ||
+            header.sdfSize != FONT_SDF_SIZE || header.sdfSpread != FONT_SDF_SPREAD ||
+            !Qube2D_Font_Hash_File(m_Path, hash) || hash != header.hash)
+            return false;
+
+
+        // Validates the page table before anything is modified
+        std::vector<FontCachePage> pages(header.pageCount);
+        std::vector<std::size_t> offsets(header.pageCount);
+        std::size_t offset = sizeof(header);
+
+        for (QUInt32 i = 0; i < header.pageCount; ++i)
+        {
+            if (size - offset < sizeof(FontCachePage))
+                return false;
+
+            std::memcpy(&pages[i], bytes.data() + offset, sizeof(FontCachePage));
+            offset += sizeof(FontCachePage);
+            offsets[i] = offset;
+
+            if (pages[i].page >= FONT_PAGE_COUNT || pages[i].rows > 2048 ||
+                size - offset < pages[i].rows * 2048u)
+                return false;
+
+            offset += pages[i].rows * 2048u;
+        }
+
+        if ((size - offset) / sizeof(FontCacheGlyph) != header.glyphCount)
+            return false;
+
+
+        // Replaces all glyphs; every page is uploaded at once
+        m_Glyphs.clear();
+        for (QUInt32 i = 0; i < FONT_PAGE_COUNT; ++i)
+        {
+            m_Packer[i].reset();
+            m_Generations[i]++;
+        }
+
+        for (QUInt32 i = 0; i < header.pageCount; ++i)
+        {
+            Texture &texture = m_Textures[pages[i].page];
+            if (texture.id() == 0)
+                Qube2D_Font_Create_Page(texture);
+            if (pages[i].rows != 0)
+                texture.updatePixels(bytes.data() + offsets[i], RectI(0, 0, 2048, pages[i].rows), TextureFormat::FormatRED);
+        }
+
+        for (QUInt32 i = 0; i < header.glyphCount; ++i)
+        {
+            FontCacheGlyph entry;
+            std::memcpy(&entry, bytes.data() + offset + i * sizeof(FontCacheGlyph), sizeof(entry));
+            if (entry.glyph.atlas_page >= FONT_PAGE_COUNT || entry.slot >= GLYPH_SLOT_COUNT)
+                continue;
+
+            entry.glyph.last_used = m_Clock;
+            if (entry.glyph.glyph_w > 0)
+                m_Packer[entry.glyph.atlas_page].claim(Qube2D_Font_Packed_Space(entry.glyph));
+
+            m_Glyphs.setSize(entry.size);
+            m_Glyphs.insert(entry.cp, entry.slot, entry.glyph);
+        }
+
+
+        // Selects the glyphs of the current size again
+        if (m_Size != 0)
+            m_Glyphs.setSize(m_DistanceField ? FONT_SDF_KEY : m_Size);
+
+        return true;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      slotOf -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 Font::slotOf(TextStyle style) const
+    {
+        return m_DistanceField ? GLYPH_SLOT_REGULAR : GlyphTable::slotOf(style);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      openMetrics
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Font::openMetrics()
+    {
+        if (m_MetricsFace != NULL)
+            return true;
+
+        // FreeType objects must not be shared with the OpenGL thread
+        if (m_MetricsLibrary == NULL && FT_Init_FreeType(&m_MetricsLibrary))
+        {
+            m_MetricsLibrary = NULL;
+            Q2DError(Q2D_FONT_ERROR_4, m_Face->family_name);
+            return false;
+        }
+
+        if (FT_New_Face(m_MetricsLibrary, m_Path.c_str(), 0, &m_MetricsFace))
+        {
+            m_MetricsFace = NULL;
+            Q2DError(Q2D_FONT_ERROR_4, m_Face->family_name);
+            return false;
+        }
+
+        FT_Select_Charmap(m_MetricsFace, FT_ENCODING_UNICODE);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      advanceOf
+    ///
+    ///////////////////////////////////////////////////////////
+    QFloat Font::advanceOf(QUInt32 prev, QUInt32 cp, TextStyle style, QUInt32 size, QBool distanceField)
+    {
+        // Mirrors the glyphs Text fetches: regular ones at the raster size
+        TextStyle regular = style & ~TextStyle::Outline;
+        QUInt32 raster = distanceField ? FONT_SDF_SIZE : size;
+        QFloat k = distanceField ? static_cast<QFloat>(size) / FONT_SDF_SIZE : 1.f;
+        QBool stroked = regular & TextStyle::Bold || regular & TextStyle::OutlineOnly;
+        QBool styled = !distanceField && stroked;
+        QFloat outline = m_OutlineWidth;
+
+        if (m_MetricsFace->size->metrics.y_ppem != raster && FT_Set_Pixel_Sizes(m_MetricsFace, 0, raster))
+            return 0.f;
+
+        // Tabs are four spaces wide
+        QUInt32 glyphCp = (cp == '\t') ? ' ' : cp;
+        QUInt64 key = FONT_JOB_KEY(raster, styled ? 1u : 0u, glyphCp);
+        std::unordered_map<QUInt64, QFloat>::iterator it = m_Advances.find(key);
+        QFloat advance = 0.f;
+
+        if (it != m_Advances.end())
+        {
+            advance = it->second;
+        }
+        else
+        {
+            // Loads the outline only, with the flags of the rasterizer
+            QInt32 flags = styled ? (FT_LOAD_TARGET_NORMAL|FT_LOAD_FORCE_AUTOHINT|FT_LOAD_NO_BITMAP) : FT_LOAD_DEFAULT;
+            if (!FT_Load_Char(m_MetricsFace, glyphCp, flags))
+                advance = m_MetricsFace->glyph->advance.x / 64.f;
+
+            m_Advances.insert(std::make_pair(key, advance));
+        }
+
+        if (styled)
+            advance += outline;
+        if (cp == '\t')
+            return advance * k * 4;
+        if (cp == ' ')
+            return advance * k;
+
+
+        // Adds the kerning against the previous glyph
+        if (prev != 0 && FT_HAS_KERNING(m_MetricsFace))
+        {
+            QUInt32 indices[2] = { prev, cp };
+            for (QUInt32 i = 0; i < 2; ++i)
+            {
+                std::unordered_map<QUInt32, QUInt32>::iterator index = m_MetricIndices.find(indices[i]);
+                if (index == m_MetricIndices.end())
+                    index = m_MetricIndices.insert(std::make_pair(indices[i], FT_Get_Char_Index(m_MetricsFace, indices[i]))).first;
+
+                indices[i] = index->second;
+            }
+
+            FT_Vector v;
+            if (!FT_Get_Kerning(m_MetricsFace, indices[0], indices[1], FT_KERNING_DEFAULT, &v))
+                advance += static_cast<QFloat>(v.x >> 6);
+        }
+
+        advance *= k;
+
+        // Stroked distance fields include the width in the pen only
+        if (distanceField && stroked)
+            advance += outline;
+
+        return advance;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      makeJob -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    GlyphJob Font::makeJob(QUInt32 cp, TextStyle style) const
+    {
+        GlyphJob job;
+        job.cp = cp;
+        job.size = m_Size;
+        job.key = m_DistanceField ? FONT_SDF_KEY : m_Size;
+        job.slot = slotOf(style);
+        job.page = m_Page;
+        job.style = style;
+        job.outlineWidth = m_OutlineWidth;
+        job.distanceField = m_DistanceField;
+        return job;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      store
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool Font::store(const GlyphBitmap &bitmap, RectI &space)
+    {
+        const GlyphJob &job = bitmap.job;
+        space = RectI(0, 0, 0, 0);
+
+        // Finds suitable space for the glyph; whitespace takes none
+        if (!bitmap.pixels.empty())
+        {
+            space = allocate(job.page, bitmap.width + 2, bitmap.height + 2);
+            space.rx()++;
+            space.ry()++;
+            space.rwidth()-=2;
+            space.rheight()-=2;
+
+            if (!space.isValid())
+            {
+            #ifdef Q2D_DEBUG
+                std::string n = std::to_string(job.cp);
+            #endif
+                Q2DError(Q2D_FONT_ERROR_2, m_Face->family_name, n.c_str());
+                return false;
+            }
+        }
+
+
+        // Initializes a new glyph structure and fills it
+        Glyph glyph;
+        glyph.texture_x = space.x() / 2048.f;
+        glyph.texture_y = space.y() / 2048.f;
+        glyph.texture_w = space.width() / 2048.f;
+        glyph.texture_h = space.height() / 2048.f;
+        glyph.glyph_w = space.width();
+        glyph.glyph_h = space.height();
+        glyph.bearing_x = bitmap.bearingX;
+        glyph.bearing_y = m_Bearings.at(job.size) - bitmap.bearingY;
+        glyph.advance = bitmap.advance;
+        glyph.atlas_page = job.page;
+        glyph.last_used = m_Clock;
+
+
+        // Workers may finish glyphs of another than the current size
+        QUInt32 current = m_DistanceField ? FONT_SDF_KEY : m_Size;
+        if (job.key != current)
+            m_Glyphs.setSize(job.key);
+
+        m_Glyphs.insert(job.cp, job.slot, glyph);
+
+        if (job.key != current)
+            m_Glyphs.setSize(current);
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      allocate
+    ///
+    ///////////////////////////////////////////////////////////
+    RectI Font::allocate(QUInt32 page, QInt32 width, QInt32 height)
+    {
+        RectI space = m_Packer[page].find(width, height);
+        if (space.isValid() || width > 2048 || height > 2048)
+            return space;
+
+
+        // Orders the glyphs of the page from least to most recently used
+        std::vector<GlyphRef> refs;
+        m_Glyphs.collect(page, refs);
+        std::sort(refs.begin(), refs.end(), [](const GlyphRef &a, const GlyphRef &b)
+        {
+            return a.glyph->last_used < b.glyph->last_used;
+        });
+
+        // Glyphs of the current layout stay; frees the others in
+        // batches, since each attempt rebuilds the free space
+        std::size_t evictable = 0;
+        while (evictable < refs.size() && refs[evictable].glyph->last_used != m_Clock)
+            evictable++;
+
+        std::size_t batch = std::max<std::size_t>(1, refs.size() / FONT_EVICT_DIVISOR);
+        for (std::size_t i = 0; i < evictable;)
+        {
+            for (std::size_t end = std::min(evictable, i + batch); i < end; i++)
+                evict(refs[i]);
+
+            m_Generations[page]++;
+            space = m_Packer[page].find(width, height);
+            if (space.isValid())
+                return space;
+        }
+
+        // The glyphs still in use fill the page; the glyph stays
+        // missing rather than evicting those of the current layout
+        // or those already uploaded along with this one.
+        return space;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      evict
+    ///
+    ///////////////////////////////////////////////////////////
+    void Font::evict(const GlyphRef &ref)
+    {
+        const Glyph &glyph = *ref.glyph;
+        m_Packer[glyph.atlas_page].release(Qube2D_Font_Packed_Space(glyph));
+        m_Glyphs.remove(ref.size, ref.slot, ref.cp);
+    }
 }
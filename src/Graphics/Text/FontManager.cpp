@@ -80,7 +80,7 @@ namespace Qube2D
         }
 
         // Creates a new Qube2D::Font structure
-        Font *font = new Font(face);
+        Font *font = new Font(face, filePath.c_str());
         m_Fonts.push_back(font);
 
         return font;
@@ -107,6 +107,19 @@ namespace Qube2D
     }
 
 
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      uploadGlyphs
+    ///
+    ///////////////////////////////////////////////////////////
+    void FontManager::uploadGlyphs()
+    {
+        for (QUInt32 i = 0; i < m_Fonts.size(); ++i)
+            m_Fonts[i]->upload();
+    }
+
+
     ///////////////////////////////////////////////////////////
     /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
     /// \date    September 14th, 2016
@@ -0,0 +1,461 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/Text/GlyphRasterizer.hpp>
+#include <Qube2D/Graphics/Text/Font.hpp>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_STROKER_H
+#include FT_BITMAP_H
+#include FT_GLYPH_H
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    /// \fn       Qube2D_GlyphRasterizer_Set_Stroker -> inline
+    /// \brief    Specifies the size of the stroker.
+    ///
+    ///////////////////////////////////////////////////////////
+    inline void Qube2D_GlyphRasterizer_Set_Stroker(FT_Stroker stroker, QUInt32 size)
+    {
+        FT_Stroker_Set(stroker,
+                       static_cast<QInt64>(size * 64),
+                       FT_STROKER_LINECAP_ROUND,
+                       FT_STROKER_LINEJOIN_ROUND,
+                       true);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       Qube2D_GlyphRasterizer_Distance_1D -> inline
+    /// \brief    Squared euclidean distance transform of a row.
+    ///
+    /// Felzenszwalb & Huttenlocher: computes the lower envelope
+    /// of the parabolas rooted at every sample in linear time.
+    ///
+    ///////////////////////////////////////////////////////////
+    inline void Qube2D_GlyphRasterizer_Distance_1D(const float *f, float *d, QInt32 *v, float *z, QInt32 n)
+    {
+        QInt32 k = 0;
+        v[0] = 0;
+        z[0] = -1e20f;
+        z[1] = +1e20f;
+
+        for (QInt32 q = 1; q < n; q++)
+        {
+            float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+            while (s <= z[k])
+            {
+                k--;
+                s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+            }
+
+            k++;
+            v[k] = q;
+            z[k] = s;
+            z[k + 1] = +1e20f;
+        }
+
+        k = 0;
+        for (QInt32 q = 0; q < n; q++)
+        {
+            while (z[k + 1] < q)
+                k++;
+
+            d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       Qube2D_GlyphRasterizer_Distance_2D -> inline
+    /// \brief    Squared distance transform of a grid, in place.
+    ///
+    ///////////////////////////////////////////////////////////
+    inline void Qube2D_GlyphRasterizer_Distance_2D(std::vector<float> &grid, QInt32 w, QInt32 h)
+    {
+        QInt32 n = std::max(w, h);
+        std::vector<float> f(n), d(n), z(n + 1);
+        std::vector<QInt32> v(n);
+
+        for (QInt32 x = 0; x < w; x++)
+        {
+            for (QInt32 y = 0; y < h; y++)
+                f[y] = grid[y * w + x];
+
+            Qube2D_GlyphRasterizer_Distance_1D(f.data(), d.data(), v.data(), z.data(), h);
+            for (QInt32 y = 0; y < h; y++)
+                grid[y * w + x] = d[y];
+        }
+
+        for (QInt32 y = 0; y < h; y++)
+        {
+            Qube2D_GlyphRasterizer_Distance_1D(&grid[y * w], d.data(), v.data(), z.data(), w);
+            std::copy(d.begin(), d.begin() + w, grid.begin() + y * w);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \fn       Qube2D_GlyphRasterizer_Distance_Field -> inline
+    /// \brief    Converts a coverage bitmap to a distance field.
+    ///
+    /// The field is padded by FONT_SDF_SPREAD pixels on every
+    /// side. The contour maps to 0.5; the value grows towards
+    /// the inside and reaches 0 or 1 at the spread distance.
+    ///
+    ///////////////////////////////////////////////////////////
+    inline void Qube2D_GlyphRasterizer_Distance_Field(const QUInt8 *src, QInt32 pitch,
+                                           QInt32 w, QInt32 h,
+                                           std::vector<QUInt8> &out)
+    {
+        const QInt32 pad = FONT_SDF_SPREAD;
+        QInt32 fw = w + pad * 2, fh = h + pad * 2;
+        std::vector<float> toInside(fw * fh), toOutside(fw * fh);
+
+        for (QInt32 y = 0; y < fh; y++)
+        {
+            for (QInt32 x = 0; x < fw; x++)
+            {
+                QInt32 bx = x - pad, by = y - pad;
+                QBool inside = bx >= 0 && by >= 0 && bx < w && by < h &&
+                               src[by * pitch + bx] > 127;
+
+                toInside[y * fw + x] = inside ? 0.f : 1e20f;
+                toOutside[y * fw + x] = inside ? 1e20f : 0.f;
+            }
+        }
+
+        Qube2D_GlyphRasterizer_Distance_2D(toInside, fw, fh);
+        Qube2D_GlyphRasterizer_Distance_2D(toOutside, fw, fh);
+
+
+        // Measures to pixel centers, thus corrects by half a pixel
+        out.resize(fw * fh);
+        for (QInt32 i = 0; i < fw * fh; i++)
+        {
+            float dist = (toInside[i] == 0.f)
+                    ? std::sqrt(toOutside[i]) - 0.5f
+                    : 0.5f - std::sqrt(toInside[i]);
+
+            float value = 0.5f + dist / (pad * 2.f);
+            out[i] = static_cast<QUInt8>(std::min(std::max(value, 0.f), 1.f) * 255.f + .5f);
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    GlyphRasterizer::GlyphRasterizer()
+        : Uncopyable(),
+          m_Stop(false)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      Destructor
+    ///
+    ///////////////////////////////////////////////////////////
+    GlyphRasterizer::~GlyphRasterizer()
+    {
+        stop();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      start
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool GlyphRasterizer::start(const std::string &path, QUInt32 threads)
+    {
+        stop();
+
+        // Every worker gets a library, face and stroker of its own
+        for (QUInt32 i = 0; i < threads; ++i)
+        {
+            FT_Library library;
+            FT_Face face;
+            FT_Stroker stroker;
+
+            if (FT_Init_FreeType(&library))
+                continue;
+
+            // Destroying the library also destroys its faces
+            if (FT_New_Face(library, path.c_str(), 0, &face) ||
+                FT_Stroker_New(library, &stroker))
+            {
+                FT_Done_FreeType(library);
+                continue;
+            }
+
+            FT_Select_Charmap(face, FT_ENCODING_UNICODE);
+            m_Libraries.push_back(library);
+            m_Faces.push_back(face);
+            m_Strokers.push_back(stroker);
+        }
+
+        if (m_Faces.empty())
+            return false;
+
+
+        // Launches the workers once all of them are set up
+        m_Stop = false;
+        for (QUInt32 i = 0; i < m_Faces.size(); ++i)
+            m_Threads.push_back(std::thread(&GlyphRasterizer::work, this, i));
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      stop
+    ///
+    ///////////////////////////////////////////////////////////
+    void GlyphRasterizer::stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+            m_Jobs.clear();
+        }
+
+        m_Wake.notify_all();
+        for (QUInt32 i = 0; i < m_Threads.size(); ++i)
+            m_Threads[i].join();
+
+        for (QUInt32 i = 0; i < m_Libraries.size(); ++i)
+        {
+            FT_Stroker_Done(m_Strokers[i]);
+            FT_Done_FreeType(m_Libraries[i]);
+        }
+
+        m_Threads.clear();
+        m_Libraries.clear();
+        m_Faces.clear();
+        m_Strokers.clear();
+        m_Done.clear();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      request
+    ///
+    ///////////////////////////////////////////////////////////
+    void GlyphRasterizer::request(const GlyphJob &job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Jobs.push_back(job);
+        }
+
+        m_Wake.notify_one();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      collect
+    ///
+    ///////////////////////////////////////////////////////////
+    void GlyphRasterizer::collect(std::vector<GlyphBitmap> &done)
+    {
+        done.clear();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        done.swap(m_Done);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      isRunning -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool GlyphRasterizer::isRunning() const
+    {
+        return !m_Threads.empty();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      rasterize
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool GlyphRasterizer::rasterize(FT_FaceRec_ *face,
+                                     FT_StrokerRec_ *stroker,
+                                     FT_LibraryRec_ *library,
+                                     GlyphBitmap &bitmap)
+    {
+        const GlyphJob &job = bitmap.job;
+        QBool styled = !job.distanceField &&
+                (job.style & TextStyle::Bold ||
+                 job.style & TextStyle::OutlineOnly ||
+                 job.style & TextStyle::Outline);
+
+        QInt32 loadFlags;
+        if (styled)
+            loadFlags = FT_LOAD_TARGET_NORMAL|FT_LOAD_FORCE_AUTOHINT|FT_LOAD_NO_BITMAP;
+        else
+            loadFlags = FT_LOAD_RENDER;
+
+
+        // Attempts to load and render a character
+        bitmap.failed = true;
+        if (face->size->metrics.y_ppem != job.size && FT_Set_Pixel_Sizes(face, 0, job.size))
+            return false;
+        if (FT_Load_Char(face, job.cp, loadFlags))
+            return false;
+
+        bitmap.failed = false;
+        bitmap.bearingX = face->glyph->metrics.horiBearingX / 64.f;
+        bitmap.bearingY = face->glyph->metrics.horiBearingY / 64.f;
+        bitmap.advance = face->glyph->advance.x / 64.f;
+
+
+        FT_Glyph glyph = NULL;
+        const FT_Bitmap *source = &face->glyph->bitmap;
+
+        if (styled && job.style & TextStyle::Bold)
+        {
+            QInt64 strength = static_cast<QInt64>((job.size / 36.f) * 64);
+
+            // Converts the glyph to a bitmap and emboldens it
+            FT_Get_Glyph(face->glyph, &glyph);
+            FT_Glyph_To_Bitmap(&glyph, FT_RENDER_MODE_NORMAL, NULL, 1);
+            FT_Bitmap_Embolden(library, &((FT_BitmapGlyph) glyph)->bitmap, strength, strength);
+            source = &((FT_BitmapGlyph) glyph)->bitmap;
+        }
+        else if (styled)
+        {
+            FT_Get_Glyph(face->glyph, &glyph);
+            Qube2D_GlyphRasterizer_Set_Stroker(stroker, job.outlineWidth);
+
+            // Applies the outline
+            if (job.style & TextStyle::OutlineOnly)
+                FT_Glyph_Stroke(&glyph, stroker, 1);
+            else
+                FT_Glyph_StrokeBorder(&glyph, stroker, 0, 1);
+
+            FT_Glyph_To_Bitmap(&glyph, FT_RENDER_MODE_NORMAL, NULL, 1);
+            source = &((FT_BitmapGlyph) glyph)->bitmap;
+        }
+
+        if (styled)
+            bitmap.advance += job.outlineWidth;
+
+
+        // Whitespace only advances
+        QInt32 w = static_cast<QInt32>(source->width);
+        QInt32 h = static_cast<QInt32>(source->rows);
+        bitmap.pixels.clear();
+
+        if (source->buffer != NULL && w > 0 && h > 0)
+        {
+            if (job.distanceField)
+            {
+                // The padding moves the quad's origin up and to the left
+                Qube2D_GlyphRasterizer_Distance_Field(source->buffer, source->pitch, w, h, bitmap.pixels);
+                w += FONT_SDF_SPREAD * 2;
+                h += FONT_SDF_SPREAD * 2;
+                bitmap.bearingX -= FONT_SDF_SPREAD;
+                bitmap.bearingY += FONT_SDF_SPREAD;
+            }
+            else
+            {
+                // Drops the row padding of the bitmap
+                bitmap.pixels.resize(w * h);
+                for (QInt32 y = 0; y < h; y++)
+                    std::memcpy(&bitmap.pixels[y * w], source->buffer + y * source->pitch, w);
+            }
+
+            bitmap.width = w;
+            bitmap.height = h;
+        }
+        else
+        {
+            bitmap.width = 0;
+            bitmap.height = 0;
+        }
+
+        if (glyph != NULL)
+            FT_Done_Glyph(glyph);
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      work
+    ///
+    ///////////////////////////////////////////////////////////
+    void GlyphRasterizer::work(QUInt32 index)
+    {
+        for (;;)
+        {
+            GlyphBitmap bitmap;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Wake.wait(lock, [this] { return m_Stop || !m_Jobs.empty(); });
+                if (m_Stop)
+                    return;
+
+                bitmap.job = m_Jobs.front();
+                m_Jobs.pop_front();
+            }
+
+            // Renders outside the lock; the FreeType objects are ours
+            rasterize(m_Faces[index], m_Strokers[index], m_Libraries[index], bitmap);
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Done.push_back(std::move(bitmap));
+        }
+    }
+}
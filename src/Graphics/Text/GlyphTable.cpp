@@ -0,0 +1,362 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/Text/GlyphTable.hpp>
+#include <cstring>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define GLYPHTABLE_INITIAL      256u
+    #define GLYPHTABLE_KEY(s,l,c)   ((static_cast<QUInt64>(s) << 32) | ((l) << 24) | (c))
+    #define GLYPHTABLE_HASH(k)      static_cast<QUInt32>(((k) * 0x9E3779B97F4A7C15ull) >> 32)
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    GlyphTable::GlyphTable()
+        : m_Page(NULL),
+          m_Size(0)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Destructor
+    ///
+    ///////////////////////////////////////////////////////////
+    GlyphTable::~GlyphTable()
+    {
+        clear();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      setSize
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool GlyphTable::setSize(QUInt32 size)
+    {
+        m_Size = size;
+        if (m_Page && m_Page->size == size)
+            return true;
+
+        // Only a handful of sizes are in use at once
+        for (std::size_t i = 0; i < m_Pages.size(); i++)
+        {
+            if (m_Pages[i]->size == size)
+            {
+                m_Page = m_Pages[i];
+                return true;
+            }
+        }
+
+        m_Page = new GlyphPage;
+        m_Page->size = size;
+        std::memset(m_Page->isCached, 0, sizeof(m_Page->isCached));
+        m_Pages.push_back(m_Page);
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      insert
+    ///
+    ///////////////////////////////////////////////////////////
+    const Glyph &GlyphTable::insert(QUInt32 cp, QUInt32 slot, const Glyph &glyph)
+    {
+        if (cp < GLYPH_DIRECT_COUNT)
+        {
+            m_Page->glyphs[slot][cp] = glyph;
+            m_Page->isCached[slot][cp] = true;
+            return m_Page->glyphs[slot][cp];
+        }
+
+        // Keeps the load factor at or below one half
+        std::size_t count = m_Glyphs.size() - m_FreeGlyphs.size();
+        if ((count + 1) * 2 > m_Keys.size())
+            grow();
+
+        QUInt64 key = GLYPHTABLE_KEY(m_Size, slot, cp);
+        QUInt32 mask = static_cast<QUInt32>(m_Keys.size()) - 1;
+        QUInt32 i = GLYPHTABLE_HASH(key) & mask;
+        while (m_Keys[i] != 0 && m_Keys[i] != key)
+            i = (i + 1) & mask;
+
+        if (m_Keys[i] == key)
+        {
+            m_Glyphs[m_Indices[i]] = glyph;
+            return m_Glyphs[m_Indices[i]];
+        }
+
+        // Reuses the storage of removed glyphs first
+        QUInt32 index;
+        if (!m_FreeGlyphs.empty())
+        {
+            index = m_FreeGlyphs.back();
+            m_FreeGlyphs.pop_back();
+            m_Glyphs[index] = glyph;
+            m_GlyphKeys[index] = key;
+        }
+        else
+        {
+            index = static_cast<QUInt32>(m_Glyphs.size());
+            m_Glyphs.push_back(glyph);
+            m_GlyphKeys.push_back(key);
+        }
+
+        m_Keys[i] = key;
+        m_Indices[i] = index;
+        return m_Glyphs[index];
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      remove
+    ///
+    ///////////////////////////////////////////////////////////
+    void GlyphTable::remove(QUInt32 size, QUInt32 slot, QUInt32 cp)
+    {
+        if (cp < GLYPH_DIRECT_COUNT)
+        {
+            for (std::size_t p = 0; p < m_Pages.size(); p++)
+            {
+                if (m_Pages[p]->size == size)
+                    m_Pages[p]->isCached[slot][cp] = false;
+            }
+
+            return;
+        }
+
+        if (m_Keys.empty())
+            return;
+
+        QUInt64 key = GLYPHTABLE_KEY(size, slot, cp);
+        QUInt32 mask = static_cast<QUInt32>(m_Keys.size()) - 1;
+        QUInt32 i = GLYPHTABLE_HASH(key) & mask;
+        while (m_Keys[i] != key)
+        {
+            if (m_Keys[i] == 0)
+                return;
+
+            i = (i + 1) & mask;
+        }
+
+        m_FreeGlyphs.push_back(m_Indices[i]);
+        m_GlyphKeys[m_Indices[i]] = 0;
+        m_Keys[i] = 0;
+
+        // Shifts following keys back, so that no probe sequence
+        // is interrupted by the hole; avoids tombstones.
+        for (QUInt32 j = (i + 1) & mask; m_Keys[j] != 0; j = (j + 1) & mask)
+        {
+            QUInt32 home = GLYPHTABLE_HASH(m_Keys[j]) & mask;
+            QBool stays = (i <= j)
+                    ? (home > i && home <= j)
+                    : (home > i || home <= j);
+
+            if (stays)
+                continue;
+
+            m_Keys[i] = m_Keys[j];
+            m_Indices[i] = m_Indices[j];
+            m_Keys[j] = 0;
+            i = j;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      collect -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    void GlyphTable::collect(QUInt32 page, std::vector<GlyphRef> &refs) const
+    {
+        gather(page, false, refs);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      collect -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    void GlyphTable::collect(std::vector<GlyphRef> &refs) const
+    {
+        gather(0, true, refs);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      clear
+    ///
+    ///////////////////////////////////////////////////////////
+    void GlyphTable::clear()
+    {
+        for (std::size_t i = 0; i < m_Pages.size(); i++)
+            delete m_Pages[i];
+
+        m_Pages.clear();
+        m_Keys.clear();
+        m_Indices.clear();
+        m_Glyphs.clear();
+        m_GlyphKeys.clear();
+        m_FreeGlyphs.clear();
+        m_Page = NULL;
+        m_Size = 0;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      findHashed -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    const Glyph *GlyphTable::findHashed(QUInt32 cp, QUInt32 slot) const
+    {
+        if (m_Keys.empty())
+            return NULL;
+
+        // The size is never zero, so neither is a valid key
+        QUInt64 key = GLYPHTABLE_KEY(m_Size, slot, cp);
+        QUInt32 mask = static_cast<QUInt32>(m_Keys.size()) - 1;
+        QUInt32 i = GLYPHTABLE_HASH(key) & mask;
+        while (m_Keys[i] != 0)
+        {
+            if (m_Keys[i] == key)
+                return &m_Glyphs[m_Indices[i]];
+
+            i = (i + 1) & mask;
+        }
+
+        return NULL;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      gather -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    void GlyphTable::gather(QUInt32 page, QBool all, std::vector<GlyphRef> &refs) const
+    {
+        for (std::size_t p = 0; p < m_Pages.size(); p++)
+        {
+            const GlyphPage *direct = m_Pages[p];
+            for (QUInt32 slot = 0; slot < GLYPH_SLOT_COUNT; slot++)
+            {
+                for (QUInt32 cp = 0; cp < GLYPH_DIRECT_COUNT; cp++)
+                {
+                    const Glyph &glyph = direct->glyphs[slot][cp];
+                    if (!direct->isCached[slot][cp])
+                        continue;
+                    if (!all && (glyph.atlas_page != page || glyph.glyph_w <= 0))
+                        continue;
+
+                    refs.push_back({ direct->size, slot, cp, &glyph });
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < m_Glyphs.size(); i++)
+        {
+            QUInt64 key = m_GlyphKeys[i];
+            const Glyph &glyph = m_Glyphs[i];
+            if (key == 0)
+                continue;
+            if (!all && (glyph.atlas_page != page || glyph.glyph_w <= 0))
+                continue;
+
+            refs.push_back({ static_cast<QUInt32>(key >> 32),
+                             static_cast<QUInt32>((key >> 24) & 0xFF),
+                             static_cast<QUInt32>(key & 0xFFFFFF),
+                             &glyph });
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      grow
+    ///
+    ///////////////////////////////////////////////////////////
+    void GlyphTable::grow()
+    {
+        std::vector<QUInt64> keys;
+        std::vector<QUInt32> indices;
+        keys.swap(m_Keys);
+        indices.swap(m_Indices);
+
+        QUInt32 capacity = keys.empty()
+                ? GLYPHTABLE_INITIAL
+                : static_cast<QUInt32>(keys.size()) * 2;
+
+        m_Keys.assign(capacity, 0);
+        m_Indices.assign(capacity, 0);
+
+        // Glyphs stay in place; only their keys are re-hashed
+        QUInt32 mask = capacity - 1;
+        for (std::size_t k = 0; k < keys.size(); k++)
+        {
+            if (keys[k] == 0)
+                continue;
+
+            QUInt32 i = GLYPHTABLE_HASH(keys[k]) & mask;
+            while (m_Keys[i] != 0)
+                i = (i + 1) & mask;
+
+            m_Keys[i] = keys[k];
+            m_Indices[i] = indices[k];
+        }
+    }
+}
@@ -0,0 +1,243 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/Text/LayoutCache.hpp>
+#include <algorithm>
+#include <iterator>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define LAYOUT_FNV_OFFSET       0xCBF29CE484222325ull
+    #define LAYOUT_FNV_PRIME        0x100000001B3ull
+    inline QUInt64 Qube2D_LayoutCache_Mix(QUInt64 hash, const void *data, std::size_t size);
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    LayoutCache::LayoutCache()
+        : Uncopyable(),
+          m_Candidates(LAYOUT_CACHE_CAPACITY, 0),
+          m_Capacity(LAYOUT_CACHE_CAPACITY)
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      setCapacity
+    ///
+    ///////////////////////////////////////////////////////////
+    void LayoutCache::setCapacity(QUInt32 capacity)
+    {
+        m_Capacity = capacity;
+        m_Candidates.assign(capacity, 0);
+
+        // Drops the least recently used layouts that exceed it
+        while (m_Entries.size() > m_Capacity)
+        {
+            m_Lookup.erase(m_Entries.back().hash);
+            m_Entries.pop_back();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      find
+    ///
+    ///////////////////////////////////////////////////////////
+    TextLayout *LayoutCache::find(const TextLayoutKey &key)
+    {
+        std::unordered_map<QUInt64, std::list<Entry>::iterator>::iterator it;
+        if ((it = m_Lookup.find(hash(key))) == m_Lookup.end())
+            return NULL;
+        if (!equals(it->second->key, key))
+            return NULL;
+
+        m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+        return &it->second->layout;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      insert
+    ///
+    ///////////////////////////////////////////////////////////
+    TextLayout *LayoutCache::insert(const TextLayoutKey &key)
+    {
+        if (m_Capacity == 0)
+            return NULL;
+
+        // Takes over the entry of the same hash, even on collision
+        QUInt64 h = hash(key);
+        std::list<Entry>::iterator entry;
+        std::unordered_map<QUInt64, std::list<Entry>::iterator>::iterator it;
+        if ((it = m_Lookup.find(h)) != m_Lookup.end())
+        {
+            entry = it->second;
+        }
+        else if (!admit(h))
+        {
+            return NULL;
+        }
+        else if (m_Entries.size() >= m_Capacity)
+        {
+            entry = std::prev(m_Entries.end());
+            m_Lookup.erase(entry->hash);
+        }
+        else
+        {
+            entry = m_Entries.insert(m_Entries.end(), Entry());
+        }
+
+        // Reuses the storage of the replaced text, if any
+        entry->hash = h;
+        entry->text = *key.text;
+        entry->key = key;
+        entry->key.text = &entry->text;
+        m_Lookup[h] = entry;
+        m_Entries.splice(m_Entries.begin(), m_Entries, entry);
+        return &entry->layout;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      clear
+    ///
+    ///////////////////////////////////////////////////////////
+    void LayoutCache::clear()
+    {
+        m_Entries.clear();
+        m_Lookup.clear();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      hash
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt64 LayoutCache::hash(const TextLayoutKey &key)
+    {
+        QUInt32 style = static_cast<QUInt32>(key.style);
+        QUInt32 flags = (key.distanceField ? 1u : 0u) | (key.measure ? 2u : 0u);
+
+        QUInt64 h = LAYOUT_FNV_OFFSET;
+        h = Qube2D_LayoutCache_Mix(h, key.text->data(), key.text->length() * sizeof(char32_t));
+        h = Qube2D_LayoutCache_Mix(h, &key.size, sizeof(key.size));
+        h = Qube2D_LayoutCache_Mix(h, &style, sizeof(style));
+        h = Qube2D_LayoutCache_Mix(h, &key.outlineWidth, sizeof(key.outlineWidth));
+        h = Qube2D_LayoutCache_Mix(h, &key.lineWidth, sizeof(key.lineWidth));
+        h = Qube2D_LayoutCache_Mix(h, &key.shadowX, sizeof(key.shadowX));
+        h = Qube2D_LayoutCache_Mix(h, &key.shadowY, sizeof(key.shadowY));
+        return Qube2D_LayoutCache_Mix(h, &flags, sizeof(flags));
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      equals
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool LayoutCache::equals(const TextLayoutKey &a, const TextLayoutKey &b)
+    {
+        QUInt32 length = a.text->length();
+        return length == b.text->length() &&
+               a.size == b.size &&
+               a.style == b.style &&
+               a.outlineWidth == b.outlineWidth &&
+               a.lineWidth == b.lineWidth &&
+               a.shadowX == b.shadowX &&
+               a.shadowY == b.shadowY &&
+               a.distanceField == b.distanceField &&
+               a.measure == b.measure &&
+               std::equal(a.text->data(), a.text->data() + length, b.text->data());
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      admit
+    ///
+    ///////////////////////////////////////////////////////////
+    QBool LayoutCache::admit(QUInt64 hash)
+    {
+        // Each hash has a single slot; a colliding hash replaces it
+        QUInt64 &slot = m_Candidates[hash % m_Candidates.size()];
+        if (slot == hash)
+        {
+            slot = 0;
+            return true;
+        }
+
+        slot = hash;
+        return false;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 17th, 2026
+    /// \fn      Qube2D_LayoutCache_Mix
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt64 Qube2D_LayoutCache_Mix(QUInt64 hash, const void *data, std::size_t size)
+    {
+        const QUInt8 *bytes = static_cast<const QUInt8 *>(data);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= LAYOUT_FNV_PRIME;
+        }
+
+        return hash;
+    }
+}
@@ -0,0 +1,418 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Debug/GLCheck.hpp>
+#include <Qube2D/Graphics/TextBatch.hpp>
+#include <Qube2D/Graphics/System/Culling.hpp>
+#include <Qube2D/Graphics/System/OpenGL/StreamBuffer.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
+#include <Qube2D/Graphics/System/Shader/TextShaders.hpp>
+#include <glad/glad.h>
+#include <algorithm>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define TBATCH_MAX_QUADS        16384u
+    #define TBATCH_TEXT_QUAD        16
+    #define TBATCH_SINGLE_VERTEX    sizeof(TextVertex)
+    #define TBATCH_OFFSET_COORD     (const void *)(sizeof(float) * 2)
+    #define TBATCH_OFFSET_COLOR     (const void *)(sizeof(float) * 4)
+    #define TBATCH_OFFSET_EDGE      (const void *)(sizeof(float) * 5)
+    #define TBATCH_BASE_VERTEX(o)   static_cast<GLint>((o) / TBATCH_SINGLE_VERTEX)
+
+
+    ///////////////////////////////////////////////////////////
+    // Static class member definitions
+    //
+    ///////////////////////////////////////////////////////////
+    ShaderProgram TextBatch::m_ShaderProgram;
+    Shader TextBatch::m_VertexShader;
+    Shader TextBatch::m_FragShader;
+    QInt32 TextBatch::m_UniformSampler;
+    QInt32 TextBatch::m_UniformMatrix;
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    TextBatch::TextBatch()
+        : Uncopyable(),
+          m_Capacity(0),
+          m_Count(0),
+          m_Texture(0),
+          m_DrawCalls(0),
+          m_TextCount(0)
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      create
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextBatch::create(QUInt32 capacity)
+    {
+        if (capacity == 0)
+            capacity = 1;
+        if (capacity > TBATCH_MAX_QUADS)
+            capacity = TBATCH_MAX_QUADS;
+
+        m_Capacity = capacity;
+        m_Vertices.resize(capacity * 4);
+
+
+        // Glyph quads are stored top-left, top-right, bottom-left
+        // and bottom-right, just like Text lays them out.
+        std::vector<QUInt16> indices(capacity * 6);
+        for (QUInt32 i = 0, v = 0; i < capacity * 6; i += 6, v += 4)
+        {
+            indices[i+0] = static_cast<QUInt16>(v + 0);
+            indices[i+1] = static_cast<QUInt16>(v + 1);
+            indices[i+2] = static_cast<QUInt16>(v + 2);
+            indices[i+3] = static_cast<QUInt16>(v + 2);
+            indices[i+4] = static_cast<QUInt16>(v + 1);
+            indices[i+5] = static_cast<QUInt16>(v + 3);
+        }
+
+
+        // The vertex array remembers the attribute layout and the
+        // index buffer, so they only need to be specified once.
+        m_VertexArray.create();
+        m_IndexBuffer.create(BufferType::Index, BufferUsage::Static);
+
+        m_VertexArray.bind();
+        m_IndexBuffer.bind();
+        m_IndexBuffer.fill(indices.data(), sizeof(QUInt16) * capacity * 6);
+        StreamBuffer::vertexStream().bind();
+
+        m_VertexArray.enableAttrib(0);
+        m_VertexArray.enableAttrib(1);
+        m_VertexArray.enableAttrib(2);
+        m_VertexArray.enableAttrib(3);
+
+        glCheck(glVertexAttribPointer(
+                    0,
+                    2,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    TBATCH_SINGLE_VERTEX,
+                    NULL));
+
+        glCheck(glVertexAttribPointer(
+                    1,
+                    2,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    TBATCH_SINGLE_VERTEX,
+                    TBATCH_OFFSET_COORD));
+
+        glCheck(glVertexAttribPointer(
+                    2,
+                    4,
+                    GL_UNSIGNED_BYTE,
+                    GL_TRUE,
+                    TBATCH_SINGLE_VERTEX,
+                    TBATCH_OFFSET_COLOR));
+
+        glCheck(glVertexAttribPointer(
+                    3,
+                    3,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    TBATCH_SINGLE_VERTEX,
+                    TBATCH_OFFSET_EDGE));
+
+        m_VertexArray.unbind();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      destroy
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextBatch::destroy()
+    {
+        m_IndexBuffer.destroy();
+        m_VertexArray.destroy();
+        m_Vertices.clear();
+        m_Capacity = 0;
+        m_Count = 0;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      begin
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextBatch::begin()
+    {
+        m_Count = 0;
+        m_Texture = 0;
+        m_DrawCalls = 0;
+        m_TextCount = 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      draw
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextBatch::draw(Text &text)
+    {
+        if (text.m_Font == NULL)
+            return;
+
+        text.refresh();
+        if (!Culling::isVisible(text.bounds()))
+            return;
+
+        // Starts a new run if the font texture changes
+        QUInt32 texture = text.texture().id();
+        if (m_Count != 0 && m_Texture != texture)
+            flush();
+
+        m_Texture = texture;
+
+
+        // The regions are laid out as fill, outline and shadow
+        Transform model = text.transform().translated(text.x(), text.y());
+        const float *fill = text.m_Staging.data();
+        const float *outline = fill + text.m_QuadCount * TBATCH_TEXT_QUAD;
+        const float *shadow = outline + text.m_OutlineQuadCount * TBATCH_TEXT_QUAD;
+
+        const GLColor &c = text.m_Color;
+        const GLColor &o = text.m_OutlineColor;
+        QFloat opacity = text.opacity();
+        QFloat edge[3];
+
+        // Matches the uniforms of Text::render for each region
+        if (text.m_ShadowQuadCount != 0)
+        {
+            float alpha = std::max(0.1f, c.a()-0.5f);
+            text.passEdges(TextStyle::DropShadow, edge);
+            addQuads(shadow, text.m_ShadowQuadCount, model,
+                     GLColor(c.r(), c.g(), c.b(), c.a() * alpha), edge);
+        }
+
+        if (text.m_OutlineQuadCount != 0)
+        {
+            text.passEdges(TextStyle::Outline, edge);
+            addQuads(outline, text.m_OutlineQuadCount, model,
+                     GLColor(o.r(), o.g(), o.b(), o.a() * opacity), edge);
+        }
+
+        text.passEdges(TextStyle::Regular, edge);
+        addQuads(fill, text.m_QuadCount, model,
+                 GLColor(c.r(), c.g(), c.b(), c.a() * opacity), edge);
+
+        m_TextCount++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      flush
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextBatch::flush()
+    {
+        if (m_Count == 0)
+            return;
+
+        // Vertices are transformed already; only project them
+        float projection[16];
+        m_Projection.toMatrix(projection);
+
+        // Binds all necessary objects
+        m_VertexArray.bind();
+        m_ShaderProgram.bind();
+
+        // Streams the quads into the shared ring buffer
+        QUInt32 offset = StreamBuffer::vertexStream().write(
+                    m_Vertices.data(),
+                    TBATCH_SINGLE_VERTEX * 4 * m_Count,
+                    TBATCH_SINGLE_VERTEX);
+
+        // Binds the font texture to unit 0
+        GLState::activeTexture(0);
+        GLState::bindTexture(m_Texture);
+
+        glCheck(glUniform1i(m_UniformSampler, 0));
+        glCheck(glUniformMatrix4fv(m_UniformMatrix, 1, GL_FALSE, projection));
+
+        // Renders all pending quads
+        glCheck(glDrawElementsBaseVertex(
+                    GL_TRIANGLES,
+                    m_Count * 6,
+                    GL_UNSIGNED_SHORT,
+                    NULL,
+                    TBATCH_BASE_VERTEX(offset)));
+
+        m_Count = 0;
+        m_DrawCalls++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      end
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextBatch::end()
+    {
+        flush();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      drawCalls -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 TextBatch::drawCalls() const
+    {
+        return m_DrawCalls;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      textCount -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 TextBatch::textCount() const
+    {
+        return m_TextCount;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      addQuads
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextBatch::addQuads(const float *quads,
+                             QUInt32 count,
+                             const Transform &model,
+                             const GLColor &color,
+                             const QFloat *edge)
+    {
+        // Packs the color once for all quads of the pass
+        unsigned char r = static_cast<unsigned char>(std::min(std::max(color.r(), 0.f), 1.f) * 255.f + .5f);
+        unsigned char g = static_cast<unsigned char>(std::min(std::max(color.g(), 0.f), 1.f) * 255.f + .5f);
+        unsigned char b = static_cast<unsigned char>(std::min(std::max(color.b(), 0.f), 1.f) * 255.f + .5f);
+        unsigned char a = static_cast<unsigned char>(std::min(std::max(color.a(), 0.f), 1.f) * 255.f + .5f);
+
+        for (QUInt32 i = 0; i < count; i++)
+        {
+            if (m_Count == m_Capacity)
+                flush();
+
+            // Each text vertex is x, y, u, v; appends the pass data
+            const float *in = quads + i * TBATCH_TEXT_QUAD;
+            TextVertex *out = &m_Vertices[m_Count * 4];
+            for (QUInt32 v = 0; v < 4; v++, in += 4, out++)
+            {
+                model.map(in[0], in[1], out->x, out->y);
+                out->u = in[2];
+                out->v = in[3];
+                out->r = r;
+                out->g = g;
+                out->b = b;
+                out->a = a;
+                out->edge = edge[0];
+                out->inner = edge[1];
+                out->softness = edge[2];
+            }
+
+            m_Count++;
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      initializeGL
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextBatch::initializeGL()
+    {
+        m_ShaderProgram.create();
+        m_VertexShader.create(ShaderType::Vertex);
+        m_FragShader.create(ShaderType::Fragment);
+
+        m_VertexShader.compileFromString(Qube2D_TextBatchVertexShader);
+        m_FragShader.compileFromString(Qube2D_TextBatchFragShader);
+        m_ShaderProgram.addShader(m_VertexShader);
+        m_ShaderProgram.addShader(m_FragShader);
+        m_ShaderProgram.link();
+        m_ShaderProgram.bind();
+
+        m_UniformMatrix = m_ShaderProgram.getUniformLocation("uni_mvp");
+        m_UniformSampler = m_ShaderProgram.getUniformLocation("uni_texture");
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      destroyGL
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextBatch::destroyGL()
+    {
+        m_VertexShader.destroy();
+        m_FragShader.destroy();
+        m_ShaderProgram.destroy();
+    }
+}
@@ -0,0 +1,288 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Debug/Debug.hpp>
+#include <Qube2D/Graphics/TextureAtlas.hpp>
+#include <Qube2D/Graphics/System/GraphicsErrors.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLErrors.hpp>
+#include <Qube2D/System/Storage/File.hpp>
+#include <Qube2D/Assets/Assets.hpp>
+#include <lodepng/lodepng.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+
+namespace Qube2D
+{
+    ///////////////////////////////////////////////////////////
+    // Constant definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define ATLAS_PAGE_SIZE     2048u
+    #define ATLAS_PIXEL_SIZE    4u
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      Default constructor
+    ///
+    ///////////////////////////////////////////////////////////
+    TextureAtlas::TextureAtlas()
+        : Uncopyable(),
+          m_Filter(InterpolationMode::NearestNeighbor),
+          m_Padding(1)
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      create
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextureAtlas::create(QUInt32 padding, InterpolationMode filter)
+    {
+        m_Padding = padding;
+        m_Filter = filter;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      destroy
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextureAtlas::destroy()
+    {
+        for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
+            it->destroy();
+
+        m_Pages.clear();
+        m_Packers.clear();
+        m_Staging.clear();
+        m_Staging.shrink_to_fit();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      load
+    ///
+    ///////////////////////////////////////////////////////////
+    TextureRegion TextureAtlas::load(const char *path)
+    {
+        assert(path);
+
+        // Determines whether the given path is relative or absolute
+        // and converts the relative to an absolute eventually.
+        std::string filePath = path;
+        if (Assets::isRelative(path))
+            filePath = Assets::makePath(path);
+
+
+        // Creates a new file handle
+        File file;
+        if (!file.open(path, FA_Read))
+        {
+            Q2DError(Q2D_ATLAS_ERROR_0, filePath.c_str());
+            return TextureRegion();
+        }
+
+        QUInt8 *bytes = file.readBytes(file.size());
+        TextureRegion region = loadFromMemory(bytes, file.size());
+        delete [] bytes;
+        return region;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      loadFromMemory
+    ///
+    ///////////////////////////////////////////////////////////
+    TextureRegion TextureAtlas::loadFromMemory(const QUInt8 *bytes, QUInt32 size)
+    {
+        assert(bytes);
+
+        // Decodes the PNG image to RGBA, regardless of its format
+        QUInt32 width, height;
+        QUInt8 *pixels = NULL;
+        if (lodepng_decode32(&pixels, &width, &height, bytes, size))
+        {
+            Q2DErrorNoArg(Q2D_TEXTURE_ERROR_1);
+            return TextureRegion();
+        }
+
+        TextureRegion region = add(pixels, width, height);
+        free(pixels);
+        return region;
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      add
+    ///
+    ///////////////////////////////////////////////////////////
+    TextureRegion TextureAtlas::add(const QUInt8 *pixels, QUInt32 width, QUInt32 height)
+    {
+        assert(pixels);
+
+        TextureRegion region;
+        QUInt32 pad = m_Padding;
+        QUInt32 outW = width + pad * 2;
+        QUInt32 outH = height + pad * 2;
+
+        if (width == 0 || height == 0 || outW > ATLAS_PAGE_SIZE || outH > ATLAS_PAGE_SIZE)
+        {
+            Q2DErrorNoArg(Q2D_ATLAS_ERROR_1);
+            return region;
+        }
+
+
+        // Attempts to find space in any existing page; earlier pages
+        // are fuller, but still may contain holes for small images.
+        RectI space(0, 0, 0, 0);
+        QUInt32 page = 0;
+        for (; page < m_Packers.size(); page++)
+        {
+            space = m_Packers[page].find(outW, outH);
+            if (space.isValid())
+                break;
+        }
+
+        if (!space.isValid())
+        {
+            addPage();
+            page = m_Packers.size() - 1;
+            space = m_Packers[page].find(outW, outH);
+        }
+
+
+        // Copies the image into the center of the staging area and
+        // extrudes its edge pixels into the surrounding padding.
+        m_Staging.resize(outW * outH * ATLAS_PIXEL_SIZE);
+        QUInt8 *dst = m_Staging.data();
+
+        for (QUInt32 y = 0; y < outH; y++)
+        {
+            QUInt32 srcY = std::min(std::max(y, pad) - pad, height - 1);
+            const QUInt8 *srcRow = pixels + srcY * width * ATLAS_PIXEL_SIZE;
+            QUInt8 *dstRow = dst + y * outW * ATLAS_PIXEL_SIZE;
+
+            for (QUInt32 x = 0; x < pad; x++)
+            {
+                memcpy(dstRow + x * ATLAS_PIXEL_SIZE, srcRow, ATLAS_PIXEL_SIZE);
+                memcpy(dstRow + (pad + width + x) * ATLAS_PIXEL_SIZE,
+                       srcRow + (width - 1) * ATLAS_PIXEL_SIZE,
+                       ATLAS_PIXEL_SIZE);
+            }
+
+            memcpy(dstRow + pad * ATLAS_PIXEL_SIZE, srcRow, width * ATLAS_PIXEL_SIZE);
+        }
+
+        m_Pages[page].updatePixels(dst, space, TextureFormat::FormatRGBA);
+
+
+        // Hands out the inner area, excluding the padding
+        region.page = m_Pages[page];
+        region.area = RectF(static_cast<QFloat>(space.x() + pad),
+                            static_cast<QFloat>(space.y() + pad),
+                            static_cast<QFloat>(width),
+                            static_cast<QFloat>(height));
+
+        return region;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      pageCount -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 TextureAtlas::pageCount() const
+    {
+        return m_Pages.size();
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      page -> const
+    ///
+    ///////////////////////////////////////////////////////////
+    const Texture &TextureAtlas::page(QUInt32 index) const
+    {
+        return m_Pages.at(index);
+    }
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      pageSize -> static
+    ///
+    ///////////////////////////////////////////////////////////
+    QUInt32 TextureAtlas::pageSize()
+    {
+        return ATLAS_PAGE_SIZE;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+    /// \date    October 16th, 2026
+    /// \fn      addPage
+    ///
+    ///////////////////////////////////////////////////////////
+    void TextureAtlas::addPage()
+    {
+        m_Pages.push_back(Texture());
+        m_Packers.push_back(Atlas<2048>());
+
+        Texture &texture = m_Pages.back();
+        texture.create(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, TextureFormat::FormatRGBA);
+        texture.setHorizontalWrap(WrapMode::ClampToEdge);
+        texture.setVerticalWrap(WrapMode::ClampToEdge);
+        texture.setMinFilter(m_Filter);
+        texture.setMagFilter(m_Filter);
+    }
+}
@@ -41,7 +41,12 @@
 #include <Qube2D/Graphics/System/Base/ISprite.hpp>
 #include <Qube2D/Graphics/System/Base/IPrimitive.hpp>
 #include <Qube2D/Graphics/System/Base/IMovable.hpp>
+#include <Qube2D/Graphics/System/OpenGL/StreamBuffer.hpp>
+#include <Qube2D/Graphics/System/OpenGL/GLState.hpp>
+#include <Qube2D/Graphics/System/Culling.hpp>
 #include <Qube2D/Graphics/Text.hpp>
+#include <Qube2D/Graphics/SpriteBatch.hpp>
+#include <Qube2D/Graphics/TextBatch.hpp>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
@@ -265,8 +270,11 @@ namespace Qube2D
     void Window::destroy(bool exit)
     {
         ISprite::destroyGL();
+        SpriteBatch::destroyGL();
         IPrimitive::destroyGL();
         Text::destroyGL();
+        TextBatch::destroyGL();
+        StreamBuffer::destroyGL();
         FontManager::destroyFT2();
 
         glfwDestroyWindow(m_Window);
@@ -316,11 +324,15 @@ namespace Qube2D
 
 
         // Initializes global OpenGL objects
+        GLState::invalidate();
         Assets::initialize();
+        StreamBuffer::initializeGL();
         ISprite::initializeGL();
+        SpriteBatch::initializeGL();
         IPrimitive::initializeGL();
         IMovable::initializeView();
         Text::initializeGL();
+        TextBatch::initializeGL();
         FontManager::initializeFT2();
 
 
@@ -347,8 +359,11 @@ namespace Qube2D
             Qube2D_Update_Callback(elapsed-current);
 
             // Renders the game
+            FontManager::uploadGlyphs();
             glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
             Qube2D_Render_Callback();
+            StreamBuffer::vertexStream().finishFrame();
+            Culling::finishFrame();
             glfwSwapBuffers(m_Window);
 
             // Sets the amount of FPS as window title, if debugging
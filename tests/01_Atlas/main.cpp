@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/System/Storage/Atlas.hpp>
+#include <iostream>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Test state
+//
+///////////////////////////////////////////////////////////
+unsigned int failures = 0;
+
+
+///////////////////////////////////////////////////////////
+/// Reports a failed expectation.
+///
+///////////////////////////////////////////////////////////
+void expect(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        std::cout << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+///////////////////////////////////////////////////////////
+/// Determines whether two rectangles share any pixel.
+///
+///////////////////////////////////////////////////////////
+bool overlap(const Qube2D::RectI &a, const Qube2D::RectI &b)
+{
+    return a.x() < b.x() + b.width() && b.x() < a.x() + a.width() &&
+           a.y() < b.y() + b.height() && b.y() < a.y() + a.height();
+}
+
+
+///////////////////////////////////////////////////////////
+/// Splitting a free rectangle keeps both remainders; the
+/// split used to read the rectangle after reallocating it.
+///
+///////////////////////////////////////////////////////////
+void testRemainders()
+{
+    Qube2D::Atlas<256> right;
+    right.find(16, 16);
+    expect(right.find(240, 256).isValid(), "space right of the first rectangle");
+
+    Qube2D::Atlas<256> below;
+    below.find(16, 16);
+    expect(below.find(256, 240).isValid(), "space below the first rectangle");
+}
+
+///////////////////////////////////////////////////////////
+/// Equal squares tile the atlas without gaps; pruning used
+/// to throw away free rectangles that were still needed.
+///
+///////////////////////////////////////////////////////////
+void testTiling(int side)
+{
+    Qube2D::Atlas<256> atlas;
+    std::vector<Qube2D::RectI> placed;
+    int count = (256 / side) * (256 / side);
+
+    for (int i = 0; i < count; i++)
+    {
+        Qube2D::RectI rect = atlas.find(side, side);
+        if (!rect.isValid())
+            break;
+
+        for (auto it = placed.begin(); it != placed.end(); ++it)
+            expect(!overlap(*it, rect), "placed rectangles overlap");
+
+        expect(rect.x() + side <= 256 && rect.y() + side <= 256, "rectangle inside the atlas");
+        placed.push_back(rect);
+    }
+
+    expect(static_cast<int>(placed.size()) == count, "squares fill the whole atlas");
+    expect(!atlas.find(1, 1).isValid(), "full atlas has no space left");
+}
+
+
+///////////////////////////////////////////////////////////
+/// Entry point
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    testRemainders();
+    testTiling(16);
+    testTiling(32);
+    testTiling(64);
+
+    std::cout << (failures ? "Atlas: failed" : "Atlas: passed") << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,276 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Window/Window.hpp>
+#include <Qube2D/Graphics/Sprite.hpp>
+#include <Qube2D/Graphics/SpriteBatch.hpp>
+#include <Qube2D/Graphics/PrimitiveBatch.hpp>
+#include <Qube2D/Graphics/Shapes/Rectangle.hpp>
+#include <glad/glad.h>
+#include <iostream>
+
+
+///////////////////////////////////////////////////////////
+// Function declarations
+//
+///////////////////////////////////////////////////////////
+int main();
+void init();
+void exit();
+void update(double deltaTime);
+void render();
+
+
+///////////////////////////////////////////////////////////
+// Test settings
+//
+///////////////////////////////////////////////////////////
+const unsigned int TEST_OBJECTS     = 4;
+const unsigned int TEST_FRAMES      = 2;
+const unsigned int TEST_PHASES      = 4;
+const int TEST_SIDE                 = 8;
+const int TEST_SPACING              = 32;
+const int TEST_HEIGHT               = 32;
+const char *TEST_NAMES[]            = { "sprites", "batched sprites", "rectangles", "batched rectangles" };
+
+
+///////////////////////////////////////////////////////////
+// Qube2D objects
+//
+///////////////////////////////////////////////////////////
+Qube2D::Window window;
+Qube2D::Texture textures[TEST_OBJECTS];
+Qube2D::Sprite sprites[TEST_OBJECTS];
+Qube2D::Rectangle rectangles[TEST_OBJECTS];
+Qube2D::SpriteBatch batch;
+Qube2D::PrimitiveBatch shapes;
+
+const Qube2D::Color colors[TEST_OBJECTS] =
+{
+    Qube2D::Color(255, 0, 0),
+    Qube2D::Color(0, 255, 0),
+    Qube2D::Color(0, 0, 255),
+    Qube2D::Color(255, 255, 255)
+};
+
+unsigned int phase = 0;
+unsigned int frame = 0;
+unsigned int failures = 0;
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 17th, 2026
+/// \fn      main
+/// \brief   Defines the main entry point for this app.
+///
+/// Draws several objects per frame through each path that
+/// streams its vertices and reads back the center pixel of
+/// every object. A wrong base vertex draws the vertices of
+/// another object, or none, at that position.
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    Qube2D::WindowSettings settings;
+
+    // ----------------------------
+    settings.setWindowPosRelative(Qube2D::WindowPosition::Center);
+    settings.setClearColor(Qube2D::Color(0, 0, 0));
+    settings.setWindowSize(Qube2D::SizeI(TEST_OBJECTS * TEST_SPACING, TEST_HEIGHT));
+    settings.setDoubleBuffer(true);
+    settings.setVerticalSync(false);
+    settings.setFullscreen(false);
+    settings.setTitle("02_StreamDraw");
+
+    // ----------------------------
+    window.setInitializeFunction(init);
+    window.setExitFunction(exit);
+    window.setUpdateFunction(update);
+    window.setRenderFunction(render);
+    window.create(settings);
+    window.start();
+
+    std::cout << (failures ? "StreamDraw: failed" : "StreamDraw: passed") << std::endl;
+    return failures ? 1 : 0;
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 17th, 2026
+/// \fn      init
+/// \brief   Initialization callback
+///
+///////////////////////////////////////////////////////////
+void init()
+{
+    for (unsigned int i = 0; i < TEST_OBJECTS; i++)
+    {
+        float x = static_cast<float>(i * TEST_SPACING + TEST_SIDE);
+        float y = static_cast<float>((TEST_HEIGHT - TEST_SIDE) / 2);
+
+        textures[i].create(TEST_SIDE, TEST_SIDE, Qube2D::TextureFormat::FormatRGBA, colors[i]);
+        sprites[i].create();
+        sprites[i].load(textures[i]);
+        sprites[i].setPosition(x, y);
+
+        rectangles[i].create();
+        rectangles[i].setRect(Qube2D::RectF(0.f, 0.f, TEST_SIDE, TEST_SIDE));
+        rectangles[i].setColor(colors[i], colors[i], colors[i], colors[i]);
+        rectangles[i].setFilled(true);
+        rectangles[i].setPosition(x, y);
+    }
+
+    batch.create();
+    shapes.create();
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 17th, 2026
+/// \fn      exit
+/// \brief   Exit callback
+///
+///////////////////////////////////////////////////////////
+void exit()
+{
+    batch.destroy();
+    shapes.destroy();
+
+    for (unsigned int i = 0; i < TEST_OBJECTS; i++)
+    {
+        sprites[i].destroy();
+        rectangles[i].destroy();
+        textures[i].destroy();
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 17th, 2026
+/// \fn      update
+/// \brief   Update callback
+///
+///////////////////////////////////////////////////////////
+void update(double deltaTime)
+{
+    for (unsigned int i = 0; i < TEST_OBJECTS; i++)
+    {
+        sprites[i].update(deltaTime);
+        rectangles[i].update(deltaTime);
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 17th, 2026
+/// \fn      verify
+/// \brief   Compares the center pixel of every object with
+///          the color it was drawn in.
+///
+///////////////////////////////////////////////////////////
+void verify()
+{
+    for (unsigned int i = 0; i < TEST_OBJECTS; i++)
+    {
+        GLubyte pixel[4];
+        GLint x = i * TEST_SPACING + TEST_SIDE + TEST_SIDE / 2;
+        GLint y = TEST_HEIGHT / 2;
+
+        glReadPixels(x, y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+        if (pixel[0] != colors[i].r() || pixel[1] != colors[i].g() || pixel[2] != colors[i].b())
+        {
+            std::cout << "FAILED: " << TEST_NAMES[phase] << ", object " << i << std::endl;
+            failures++;
+        }
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// \author  Nicolas Kogler (kogler.cml@hotmail.com)
+/// \date    October 17th, 2026
+/// \fn      render
+/// \brief   Render callback
+///
+///////////////////////////////////////////////////////////
+void render()
+{
+    if (phase >= TEST_PHASES)
+        return;
+
+    if (phase == 0)
+    {
+        for (unsigned int i = 0; i < TEST_OBJECTS; i++)
+            sprites[i].render();
+    }
+    else if (phase == 1)
+    {
+        batch.begin();
+        for (unsigned int i = 0; i < TEST_OBJECTS; i++)
+            batch.draw(sprites[i]);
+        batch.end();
+    }
+    else if (phase == 2)
+    {
+        for (unsigned int i = 0; i < TEST_OBJECTS; i++)
+            rectangles[i].render();
+    }
+    else
+    {
+        shapes.begin();
+        for (unsigned int i = 0; i < TEST_OBJECTS; i++)
+            shapes.draw(rectangles[i]);
+        shapes.end();
+    }
+
+    // Checks the last frame, whose vertices never start at offset zero
+    if (++frame == TEST_FRAMES)
+    {
+        verify();
+        frame = 0;
+
+        if (++phase == TEST_PHASES)
+            window.stop();
+    }
+}
@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/SpatialIndex.hpp>
+#include <Qube2D/Graphics/Shapes/Rectangle.hpp>
+#include <Qube2D/Graphics/Shapes/Circle.hpp>
+#include <iostream>
+#include <vector>
+
+
+///////////////////////////////////////////////////////////
+// Test state
+//
+///////////////////////////////////////////////////////////
+unsigned int failures = 0;
+
+
+///////////////////////////////////////////////////////////
+/// Reports a failed expectation.
+///
+///////////////////////////////////////////////////////////
+void expect(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        std::cout << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+///////////////////////////////////////////////////////////
+/// Determines whether a point query finds the object.
+///
+///////////////////////////////////////////////////////////
+bool finds(Qube2D::SpatialIndex &index, float x, float y, Qube2D::ISpatial *object)
+{
+    std::vector<Qube2D::ISpatial *> result;
+    index.query(x, y, result);
+
+    for (auto it = result.begin(); it != result.end(); ++it)
+        if (*it == object)
+            return true;
+
+    return false;
+}
+
+
+///////////////////////////////////////////////////////////
+/// Resizing a rectangle moves it into the new cells and
+/// out of the ones it does not cover anymore.
+///
+///////////////////////////////////////////////////////////
+void testRectangle()
+{
+    Qube2D::SpatialIndex index(64.f);
+    Qube2D::Rectangle rect;
+    rect.setRect(Qube2D::RectF(0.f, 0.f, 16.f, 16.f));
+    index.insert(&rect);
+
+    expect(finds(index, 8.f, 8.f, &rect), "rectangle found before resizing");
+    expect(!finds(index, 300.f, 300.f, &rect), "rectangle not found outside");
+
+    rect.setRect(Qube2D::RectF(0.f, 0.f, 400.f, 400.f));
+    expect(finds(index, 300.f, 300.f, &rect), "grown rectangle found in new cells");
+
+    rect.setRect(Qube2D::RectF(200.f, 200.f, 16.f, 16.f));
+    expect(!finds(index, 8.f, 8.f, &rect), "moved rectangle left its old cells");
+    expect(finds(index, 208.f, 208.f, &rect), "moved rectangle found in new cells");
+
+    rect.destroy();
+    expect(!finds(index, 208.f, 208.f, &rect), "destroyed rectangle left the index");
+    expect(rect.spatialIndex() == NULL, "destroyed rectangle is untracked");
+}
+
+///////////////////////////////////////////////////////////
+/// Changing the radius of a circle updates its cells.
+///
+///////////////////////////////////////////////////////////
+void testCircle()
+{
+    Qube2D::SpatialIndex index(64.f);
+    Qube2D::Circle circle;
+    circle.setRadius(8.f);
+    index.insert(&circle);
+
+    expect(!finds(index, 150.f, 150.f, &circle), "small circle not found far away");
+
+    circle.setRadius(100.f);
+    expect(finds(index, 150.f, 150.f, &circle), "grown circle found in new cells");
+
+    circle.setRadius(8.f);
+    expect(!finds(index, 150.f, 150.f, &circle), "shrunk circle left its old cells");
+}
+
+///////////////////////////////////////////////////////////
+/// Cells left behind by moving objects are erased.
+///
+///////////////////////////////////////////////////////////
+void testScrolling()
+{
+    Qube2D::SpatialIndex index(64.f);
+    Qube2D::Rectangle rect;
+    rect.setRect(Qube2D::RectF(0.f, 0.f, 16.f, 16.f));
+    index.insert(&rect);
+
+    for (int i = 1; i <= 100; i++)
+    {
+        rect.setRect(Qube2D::RectF(i * 100.f, 0.f, 16.f, 16.f));
+        index.update();
+    }
+
+    expect(index.cellCount() == 1, "moved rectangle occupies one cell");
+    expect(finds(index, 10008.f, 8.f, &rect), "moved rectangle found at its end");
+
+    index.remove(&rect);
+    expect(index.cellCount() == 0, "removed rectangle leaves no cells");
+}
+
+
+///////////////////////////////////////////////////////////
+/// Entry point
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    testRectangle();
+    testCircle();
+    testScrolling();
+
+    std::cout << (failures ? "SpatialIndex: failed" : "SpatialIndex: passed") << std::endl;
+    return failures ? 1 : 0;
+}
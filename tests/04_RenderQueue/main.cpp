@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/Graphics/RenderQueue.hpp>
+#include <Qube2D/Graphics/Shapes/Rectangle.hpp>
+#include <iostream>
+
+
+///////////////////////////////////////////////////////////
+// Test state
+//
+///////////////////////////////////////////////////////////
+unsigned int failures = 0;
+
+
+///////////////////////////////////////////////////////////
+/// Reports a failed expectation.
+///
+///////////////////////////////////////////////////////////
+void expect(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        std::cout << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+///////////////////////////////////////////////////////////
+/// Creates a filled rectangle at the given place.
+///
+///////////////////////////////////////////////////////////
+void place(Qube2D::Rectangle &rect, float x, float y, float w, float h)
+{
+    rect.create();
+    rect.setRect(Qube2D::RectF(x, y, w, h));
+    rect.setFilled(true);
+}
+
+///////////////////////////////////////////////////////////
+/// Determines the position of an object in the queue.
+///
+///////////////////////////////////////////////////////////
+unsigned int indexOf(const Qube2D::RenderQueue &queue, const void *object)
+{
+    const std::vector<Qube2D::RenderItem> &items = queue.items();
+    for (unsigned int i = 0; i < items.size(); i++)
+        if (items[i].object == object)
+            return i;
+
+    return static_cast<unsigned int>(items.size());
+}
+
+
+///////////////////////////////////////////////////////////
+/// Overlapping shapes keep their order; one that overlaps
+/// neither may be moved in front of the later one.
+///
+///////////////////////////////////////////////////////////
+void testOverlap()
+{
+    Qube2D::RenderQueue queue;
+    Qube2D::Rectangle a, b, c;
+    place(a, 0.f, 0.f, 32.f, 32.f);
+    place(b, 16.f, 16.f, 32.f, 32.f);
+    place(c, 500.f, 500.f, 32.f, 32.f);
+
+    queue.submit(a);
+    queue.submit(b);
+    queue.submit(c);
+    queue.sort();
+
+    expect(indexOf(queue, &a) < indexOf(queue, &b), "overlapping shapes keep their order");
+    expect(indexOf(queue, &c) < indexOf(queue, &b), "separate shape is grouped with the first band");
+}
+
+///////////////////////////////////////////////////////////
+/// Lower layers are drawn first, regardless of submission.
+///
+///////////////////////////////////////////////////////////
+void testLayers()
+{
+    Qube2D::RenderQueue queue;
+    Qube2D::Rectangle top, bottom;
+    place(top, 0.f, 0.f, 32.f, 32.f);
+    place(bottom, 0.f, 0.f, 32.f, 32.f);
+
+    queue.submit(top, 1);
+    queue.submit(bottom, 0);
+    queue.sort();
+
+    expect(indexOf(queue, &bottom) < indexOf(queue, &top), "lower layer drawn first");
+}
+
+///////////////////////////////////////////////////////////
+/// A shape spanning too many cells is drawn between all
+/// earlier and all later shapes of its layer.
+///
+///////////////////////////////////////////////////////////
+void testLargeShape()
+{
+    Qube2D::RenderQueue queue;
+    Qube2D::Rectangle before, background, after;
+    place(before, 0.f, 0.f, 32.f, 32.f);
+    place(background, 0.f, 0.f, 4096.f, 4096.f);
+    place(after, 1000.f, 1000.f, 32.f, 32.f);
+
+    queue.submit(before);
+    queue.submit(background);
+    queue.submit(after);
+    queue.sort();
+
+    expect(indexOf(queue, &before) < indexOf(queue, &background), "large shape after earlier ones");
+    expect(indexOf(queue, &background) < indexOf(queue, &after), "large shape before later ones");
+
+    // Clearing forgets the shapes of the last frame
+    queue.clear();
+    queue.submit(after);
+    queue.submit(before);
+    queue.sort();
+
+    expect(indexOf(queue, &after) == 0, "cleared queue starts without bands");
+}
+
+///////////////////////////////////////////////////////////
+/// Without state sorting, submission order is kept.
+///
+///////////////////////////////////////////////////////////
+void testSubmissionOrder()
+{
+    Qube2D::RenderQueue queue;
+    Qube2D::Rectangle a, b, c;
+    place(a, 0.f, 0.f, 32.f, 32.f);
+    place(b, 16.f, 16.f, 32.f, 32.f);
+    place(c, 500.f, 500.f, 32.f, 32.f);
+
+    queue.setStateSorting(false);
+    queue.submit(a);
+    queue.submit(b);
+    queue.submit(c);
+    queue.sort();
+
+    expect(indexOf(queue, &a) == 0 && indexOf(queue, &b) == 1 && indexOf(queue, &c) == 2,
+           "submission order kept without state sorting");
+}
+
+
+///////////////////////////////////////////////////////////
+/// Entry point
+///
+///////////////////////////////////////////////////////////
+int main()
+{
+    testOverlap();
+    testLayers();
+    testLargeShape();
+    testSubmissionOrder();
+
+    std::cout << (failures ? "RenderQueue: failed" : "RenderQueue: passed") << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,39 @@
+#
+#  QMake settings
+#
+CONFIG         -= qt
+CONFIG         += c++11 console
+TEMPLATE        = app
+TARGET          = AtlasPacker
+QMAKE_CXXFLAGS_WARN_ON -= -Wall
+QMAKE_CXXFLAGS_WARN_ON += -Wno-comment
+QMAKE_CXXFLAGS += -std=c++11
+
+
+#
+#  Output path
+#
+CONFIG(debug, debug|release) {
+    DESTDIR = debug
+} else {
+    DESTDIR = release
+}
+
+OBJECTS_DIR = $$DESTDIR/obj
+
+
+#
+#  Include paths
+#  Note: Only the header-only packers of Qube2D are used,
+#        so the tool does not link against the library.
+#
+INCLUDEPATH += $$PWD/../../include
+INCLUDEPATH += $$PWD/../../deps
+
+
+#
+#  Source files
+#
+SOURCES += \
+    main.cpp \
+    ../../deps/lodepng/lodepng.cpp
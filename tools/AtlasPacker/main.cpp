@@ -0,0 +1,439 @@
+///////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                    ___        _            ____  ____
+//                   / _ \ _   _| |__   ___  |___ \|  _ \
+//                  | | | | | | | '_ \ / _ \   __) | | | |
+//                  | |_| | |_| | |_) |  __/  / __/| |_| |
+//                   \__\_\\__,_|_.__/ \___| |_____|____/
+//
+//
+//
+//  Easy to use cross-platform 2D game engine written in C++, using the OpenGL API.
+//  Copyright (C) 2016 Nicolas Kogler (kogler.cml@hotmail.com)
+//
+//  This file is part of Qube2D.
+//
+//  Qube2D is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Qube2D is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with  Qube2D. If not, see <http://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Included files
+//
+///////////////////////////////////////////////////////////
+#include <Qube2D/System/Storage/Atlas.hpp>
+#include <Qube2D/System/Storage/Guillotine.hpp>
+#include <Qube2D/System/Storage/Skyline.hpp>
+#include <Qube2D/Graphics/System/Structs/AtlasFile.hpp>
+#include <lodepng/lodepng.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <dirent.h>
+#   include <sys/stat.h>
+#endif
+
+using namespace Qube2D;
+
+
+///////////////////////////////////////////////////////////
+// Packer settings
+//
+///////////////////////////////////////////////////////////
+#define PACKER_PAGE_SIZE    2048
+#define PACKER_PIXEL_SIZE   4
+
+
+///////////////////////////////////////////////////////////
+// Type definitions
+//
+///////////////////////////////////////////////////////////
+struct Image
+{
+    std::string name;               ///< Name without extension
+    std::vector<QUInt8> pixels;     ///< RGBA8 pixels
+    QUInt32 width;                  ///< Width in pixels
+    QUInt32 height;                 ///< Height in pixels
+    QUInt32 page;                   ///< Page the image was put on
+    RectI space;                    ///< Padded area within the page
+};
+
+
+///////////////////////////////////////////////////////////
+// Function declarations
+//
+///////////////////////////////////////////////////////////
+int main(int argc, char **argv);
+void usage();
+void listFiles(const std::string &folder, const std::string &prefix, std::vector<std::string> &names);
+bool loadImages(const std::string &folder, std::vector<Image> &images);
+template <typename T> QUInt32 pack(std::vector<Image *> &order, QUInt32 padding);
+void extrude(const Image &image, QUInt32 padding, std::vector<QUInt8> &page);
+bool write(const char *path, std::vector<Image> &images, QUInt32 pageCount, QUInt32 padding);
+
+
+///////////////////////////////////////////////////////////
+/// \fn     main
+/// \brief  Packs all PNG images of a folder into a .qatlas file.
+///
+///////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+    bool skyline = false;
+    bool guillotine = false;
+    QUInt32 padding = 1;
+    std::vector<const char *> paths;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--skyline"))
+            skyline = true;
+        else if (!strcmp(argv[i], "--guillotine"))
+            guillotine = true;
+        else if (!strcmp(argv[i], "--padding") && i + 1 < argc)
+            padding = static_cast<QUInt32>(atoi(argv[++i]));
+        else
+            paths.push_back(argv[i]);
+    }
+
+    if (paths.size() != 2)
+    {
+        usage();
+        return 1;
+    }
+
+
+    // Decodes all images once; the runtime never has to
+    std::vector<Image> images;
+    if (!loadImages(paths[0], images))
+        return 1;
+
+    // Packs the tallest images first, which wastes less space
+    std::vector<Image *> order;
+    for (auto it = images.begin(); it != images.end(); ++it)
+        order.push_back(&*it);
+
+    std::stable_sort(order.begin(), order.end(), [](const Image *a, const Image *b)
+    {
+        if (a->height != b->height)
+            return a->height > b->height;
+        return a->width > b->width;
+    });
+
+    QUInt32 pages = skyline
+            ? pack<Skyline<PACKER_PAGE_SIZE> >(order, padding)
+            : guillotine
+            ? pack<Guillotine<PACKER_PAGE_SIZE> >(order, padding)
+            : pack<Atlas<PACKER_PAGE_SIZE> >(order, padding);
+
+    if (pages == 0)
+        return 1;
+
+    if (!write(paths[1], images, pages, padding))
+        return 1;
+
+
+    // Prints how well the images were packed
+    QUInt64 used = 0;
+    for (auto it = images.begin(); it != images.end(); ++it)
+        used += QUInt64(it->width) * it->height;
+
+    std::cout << images.size() << " images packed into " << pages << " page(s), "
+              << (100.0 * used / (QUInt64(pages) * PACKER_PAGE_SIZE * PACKER_PAGE_SIZE))
+              << "% of the space in use." << std::endl;
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////
+/// \fn     usage
+/// \brief  Prints the command line arguments.
+///
+///////////////////////////////////////////////////////////
+void usage()
+{
+    std::cerr << "Usage: AtlasPacker [--skyline|--guillotine] [--padding <pixels>] <folder> <output.qatlas>\n\n"
+              << "Packs all PNG images within <folder> and its subfolders into\n"
+              << PACKER_PAGE_SIZE << "x" << PACKER_PAGE_SIZE << " pages. Images are named by their path relative\n"
+              << "to <folder>, without extension, e.g. \"ui/button\".\n\n"
+              << "  --skyline     Uses the fastest, but least tight skyline packer\n"
+              << "  --guillotine  Uses the guillotine packer, between both\n"
+              << "  --padding     Extruded border around each image (default: 1)\n";
+}
+
+///////////////////////////////////////////////////////////
+/// \fn     listFiles
+/// \brief  Gathers all PNG files of a folder, recursively.
+///
+///////////////////////////////////////////////////////////
+void listFiles(const std::string &folder, const std::string &prefix, std::vector<std::string> &names)
+{
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA((folder + "\\*").c_str(), &data);
+    if (handle == INVALID_HANDLE_VALUE)
+        return;
+
+    do
+    {
+        std::string name = data.cFileName;
+        bool isFolder = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+#else
+    DIR *dir = opendir(folder.c_str());
+    if (!dir)
+        return;
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        std::string name = entry->d_name;
+        struct stat info;
+        bool isFolder = stat((folder + "/" + name).c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+#endif
+
+        if (name == "." || name == "..")
+            continue;
+
+        if (isFolder)
+            listFiles(folder + "/" + name, prefix + name + "/", names);
+        else if (name.size() > 4 && name.compare(name.size() - 4, 4, ".png") == 0)
+            names.push_back(prefix + name);
+
+#ifdef _WIN32
+    } while (FindNextFileA(handle, &data));
+    FindClose(handle);
+#else
+    }
+    closedir(dir);
+#endif
+}
+
+///////////////////////////////////////////////////////////
+/// \fn     loadImages
+/// \brief  Decodes all PNG images of a folder to RGBA.
+///
+///////////////////////////////////////////////////////////
+bool loadImages(const std::string &folder, std::vector<Image> &images)
+{
+    std::vector<std::string> files;
+    listFiles(folder, "", files);
+    std::sort(files.begin(), files.end());
+
+    if (files.empty())
+    {
+        std::cerr << "No PNG images found in '" << folder << "'." << std::endl;
+        return false;
+    }
+
+    images.resize(files.size());
+    for (QUInt32 i = 0; i < files.size(); i++)
+    {
+        Image &image = images[i];
+        QUInt8 *pixels = NULL;
+
+        if (lodepng_decode32_file(&pixels, &image.width, &image.height,
+                                  (folder + "/" + files[i]).c_str()))
+        {
+            std::cerr << "Could not decode '" << files[i] << "'." << std::endl;
+            return false;
+        }
+
+        image.name = files[i].substr(0, files[i].size() - 4);
+        image.pixels.assign(pixels, pixels + image.width * image.height * PACKER_PIXEL_SIZE);
+        free(pixels);
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////
+/// \fn       pack
+/// \brief    Places all images on as few pages as possible.
+/// \returns  the amount of pages or zero on failure.
+///
+///////////////////////////////////////////////////////////
+template <typename T>
+QUInt32 pack(std::vector<Image *> &order, QUInt32 padding)
+{
+    std::vector<T> pages;
+
+    for (auto it = order.begin(); it != order.end(); ++it)
+    {
+        Image &image = **it;
+        QInt32 w = image.width + padding * 2;
+        QInt32 h = image.height + padding * 2;
+
+        if (image.width == 0 || image.height == 0 || w > PACKER_PAGE_SIZE || h > PACKER_PAGE_SIZE)
+        {
+            std::cerr << "'" << image.name << "' does not fit into a page." << std::endl;
+            return 0;
+        }
+
+        // Tries all pages before starting a new one
+        image.space = RectI(0, 0, 0, 0);
+        for (QUInt32 i = 0; i < pages.size() && !image.space.isValid(); i++)
+        {
+            image.space = pages[i].find(w, h);
+            image.page = i;
+        }
+
+        if (!image.space.isValid())
+        {
+            pages.push_back(T());
+            image.space = pages.back().find(w, h);
+            image.page = pages.size() - 1;
+        }
+    }
+
+    return pages.size();
+}
+
+///////////////////////////////////////////////////////////
+/// \fn     extrude
+/// \brief  Copies an image and its extruded edges into a page.
+///
+///////////////////////////////////////////////////////////
+void extrude(const Image &image, QUInt32 padding, std::vector<QUInt8> &page)
+{
+    QUInt32 outW = image.width + padding * 2;
+    QUInt32 outH = image.height + padding * 2;
+
+    for (QUInt32 y = 0; y < outH; y++)
+    {
+        QUInt32 srcY = std::min(std::max(y, padding) - padding, image.height - 1);
+        const QUInt8 *src = &image.pixels[srcY * image.width * PACKER_PIXEL_SIZE];
+        QUInt8 *dst = &page[((image.space.y() + y) * PACKER_PAGE_SIZE + image.space.x()) * PACKER_PIXEL_SIZE];
+
+        for (QUInt32 x = 0; x < outW; x++)
+        {
+            QUInt32 srcX = std::min(std::max(x, padding) - padding, image.width - 1);
+            memcpy(dst + x * PACKER_PIXEL_SIZE, src + srcX * PACKER_PIXEL_SIZE, PACKER_PIXEL_SIZE);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////
+/// \fn     write
+/// \brief  Renders the pages and writes the .qatlas file.
+///
+///////////////////////////////////////////////////////////
+bool write(const char *path, std::vector<Image> &images, QUInt32 pageCount, QUInt32 padding)
+{
+    // Sorts the entries by hash, so they can be binary-searched
+    std::vector<AtlasFileEntry> entries(images.size());
+    std::vector<const Image *> sorted;
+    for (auto it = images.begin(); it != images.end(); ++it)
+        sorted.push_back(&*it);
+
+    std::sort(sorted.begin(), sorted.end(), [](const Image *a, const Image *b)
+    {
+        QUInt32 ha = atlasHash(a->name.c_str());
+        QUInt32 hb = atlasHash(b->name.c_str());
+        return ha != hb ? ha < hb : a->name < b->name;
+    });
+
+    std::string names;
+    for (QUInt32 i = 0; i < sorted.size(); i++)
+    {
+        const Image &image = *sorted[i];
+        AtlasFileEntry &entry = entries[i];
+        entry.hash = atlasHash(image.name.c_str());
+        entry.name = names.size();
+        entry.page = static_cast<QUInt16>(image.page);
+        entry.x = static_cast<QUInt16>(image.space.x() + padding);
+        entry.y = static_cast<QUInt16>(image.space.y() + padding);
+        entry.width = static_cast<QUInt16>(image.width);
+        entry.height = static_cast<QUInt16>(image.height);
+        entry.reserved = 0;
+
+        names.append(image.name);
+        names.push_back('\0');
+    }
+
+    while (names.size() % 4 != 0)
+        names.push_back('\0');
+
+
+    // Renders and compresses each page
+    std::vector<std::vector<QUInt8> > pngs(pageCount);
+    std::vector<QUInt8> pixels;
+
+    for (QUInt32 p = 0; p < pageCount; p++)
+    {
+        pixels.assign(PACKER_PAGE_SIZE * PACKER_PAGE_SIZE * PACKER_PIXEL_SIZE, 0);
+        for (auto it = images.begin(); it != images.end(); ++it)
+            if (it->page == p)
+                extrude(*it, padding, pixels);
+
+        QUInt8 *png = NULL;
+        size_t size = 0;
+        if (lodepng_encode32(&png, &size, pixels.data(), PACKER_PAGE_SIZE, PACKER_PAGE_SIZE))
+        {
+            std::cerr << "Could not encode page " << p << "." << std::endl;
+            return false;
+        }
+
+        pngs[p].assign(png, png + size);
+        free(png);
+    }
+
+
+    // Lays out the tables in front of the page images
+    AtlasFileHeader header;
+    header.magic = Q2D_ATLAS_FILE_MAGIC;
+    header.version = Q2D_ATLAS_FILE_VERSION;
+    header.pageSize = PACKER_PAGE_SIZE;
+    header.pageCount = pageCount;
+    header.entryCount = entries.size();
+    header.pageOffset = sizeof(AtlasFileHeader);
+    header.entryOffset = header.pageOffset + pageCount * sizeof(AtlasFilePage);
+    header.nameOffset = header.entryOffset + entries.size() * sizeof(AtlasFileEntry);
+
+    std::vector<AtlasFilePage> pages(pageCount);
+    QUInt32 offset = header.nameOffset + names.size();
+    for (QUInt32 p = 0; p < pageCount; p++)
+    {
+        pages[p].offset = offset;
+        pages[p].size = pngs[p].size();
+        offset += pngs[p].size();
+    }
+
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+    {
+        std::cerr << "Could not open '" << path << "' for writing." << std::endl;
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(pages.data()), pages.size() * sizeof(AtlasFilePage));
+    file.write(reinterpret_cast<const char *>(entries.data()), entries.size() * sizeof(AtlasFileEntry));
+    file.write(names.data(), names.size());
+    for (QUInt32 p = 0; p < pageCount; p++)
+        file.write(reinterpret_cast<const char *>(pngs[p].data()), pngs[p].size());
+
+    return file.good();
+}